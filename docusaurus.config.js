@@ -6,6 +6,28 @@
 
 /*import { Redirect } from "@docusaurus/router";*/
 import { themes as prismThemes } from "prism-react-renderer";
+import remarkOpenApiEndpoint from "./plugins/openapi/remark-endpoint";
+import remarkLazyEndpoints from "./plugins/lazy-endpoints/remark";
+import remarkImages from "./plugins/images/remark";
+import remarkStaticHighlight from "./plugins/highlight/remark";
+import remarkExamplePayloads from "./plugins/example-payloads/remark";
+import frozenVersions from "./frozen-versions.json";
+
+// Frozen versions are separate builds (scripts/build-versions.js) served
+// under /versions/<version>/: `pathname://` links leave this build's
+// router and baseUrl. DOCS_VERSION is set while building one of them.
+const versionsDropdown = {
+  label: process.env.DOCS_VERSION || "LATEST",
+  position: "right",
+  type: "dropdown",
+  items: [
+    { label: "Latest", to: "pathname:///" },
+    ...frozenVersions.map(({ version, apiVersion }) => ({
+      label: apiVersion ? `${version} (API ${apiVersion})` : version,
+      to: `pathname:///versions/${version}/`,
+    })),
+  ],
+};
 
 /** @type {import('@docusaurus/types').Config} */
 const config = {
@@ -41,6 +63,13 @@ const config = {
     format: "detect",
   },
 
+  future: {
+    experimental_faster: {
+      // Compile each MDX file once for both the client and server bundles
+      mdxCrossCompilerCache: true,
+    },
+  },
+
   presets: [
     [
       "classic",
@@ -49,6 +78,20 @@ const config = {
         docs: {
           routeBasePath: '/',
           sidebarPath: "./sidebars.js",
+          remarkPlugins: [
+            // Splits `lazy_endpoints: true` pages into per-endpoint chunks; runs
+            // first so it slices the authored source, not generated nodes
+            remarkLazyEndpoints,
+            // Expands <OpenApiEndpoint> / <OpenApiProperties> from static/openapi/openapi.json
+            remarkOpenApiEndpoint,
+            // Intrinsic sizes and AVIF/WebP srcSets for imported screenshots
+            remarkImages,
+            // Moves large example responses of `example_payloads: true` pages to
+            // JSON assets fetched on expand; before highlighting turns them into HTML
+            remarkExamplePayloads,
+            // Highlights code blocks at compile time (colors from ./plugins/highlight)
+            remarkStaticHighlight,
+          ],
           // Please change this to your repo.
           // Remove this to remove the "edit this page" links.
           /*editUrl:
@@ -161,6 +204,11 @@ const config = {
             to: "/migration-guides/",
             className: "navbarLink",
           },
+          ...(frozenVersions.length ? [versionsDropdown] : []),
+          {
+            type: "custom-localSearch",
+            position: "right",
+          },
           {
             type: "search",
             position: "right",
@@ -213,160 +261,40 @@ const config = {
       },
     }),
 
+  clientModules: [
+    // Sampled Web Vitals (LCP, INP, CLS, TTFB, hydration) sent through gtag
+    "./src/clientModules/webVitals.ts",
+    // Page-to-page navigation counts for the route prefetcher
+    "./src/clientModules/navigationHistory.ts",
+    // Keeps the opt-in offline service worker registered (plugins/offline)
+    "./src/clientModules/serviceWorker.ts",
+  ],
+
   plugins: [
-    [
-      '@docusaurus/plugin-client-redirects',
-      {
-        redirects: [
-          {
-            to: '/tutorials/create-a-conversion',
-            from: '/quickstart-guides/conversion-quickstart'
-          },
-          {
-            to: '/tutorials/upload-a-matched-audience',
-            from: '/quickstart-guides/matched-audience-upload-api-quickstart-guide/'
-          },
-          {
-            to: '/tutorials/create-a-bid-model',
-            from: '/quickstart-guides/bid-model-quickstart/'
-          },
-          {
-            to: '/tutorials/optimize-your-inventory',
-            from: '/quickstart-guides/inventory-quickstart/'
-          },
-          {
-            to: '/tutorials/create-an-insights-report',
-            from: '/quickstart-guides/insights-quickstart/'
-          },
-          {
-            to: '/tutorials/create-a-pg-campaign',
-            from: '/quickstart-guides/upload-creative-and-create-a-campaign-api-quickstart-guide'
-          }
-        ],
-        createRedirects(existingPath) {
-          const redirects = [];
-          
-          // Helper function to convert dash-case to PascalCase with dashes
-          const toPascalCase = (str) => {
-            return str.split('-').map(word => 
-              word.charAt(0).toUpperCase() + word.slice(1).toLowerCase()
-            ).join('-');
-          };
-          
-          // Getting Started: OLD /Getting Started & /Getting%20Started -> NEW /getting-started
-          if (existingPath.includes('/getting-started')) {
-            // Extract the file path after the folder
-            const afterFolder = existingPath.split('/getting-started')[1];
-            
-            if (afterFolder && afterFolder !== '/') {
-              // Convert file name to PascalCase for old URLs
-              const pathParts = afterFolder.split('/').filter(p => p);
-              const pascalParts = pathParts.map(toPascalCase);
-              const pascalPath = '/' + pascalParts.join('/') + '/';
-              
-              // Only add PascalCase filenames (old style), not lowercase
-              redirects.push(
-                '/Getting Started' + pascalPath,
-                '/Getting%20Started' + pascalPath
-              );
-            } else {
-              // Just the folder index
-              redirects.push(
-                '/Getting Started/',
-                '/Getting%20Started/'
-              );
-            }
-          }
-          
-          // Healthcare Vertical: /healthcare-vertical -> /Healthcare Vertical & /Healthcare%20Vertical
-          if (existingPath.includes('/healthcare-vertical')) {
-            const afterFolder = existingPath.split('/healthcare-vertical')[1];
-            
-            if (afterFolder && afterFolder !== '/') {
-              const pathParts = afterFolder.split('/').filter(p => p);
-              const pascalParts = pathParts.map(toPascalCase);
-              const pascalPath = '/' + pascalParts.join('/') + '/';
-              
-              redirects.push(
-                '/Healthcare Vertical' + pascalPath,
-                '/Healthcare%20Vertical' + pascalPath
-              );
-            } else {
-              redirects.push(
-                '/Healthcare Vertical/',
-                '/Healthcare%20Vertical/'
-              );
-            }
-          }
-          
-          // Political Vertical: /political-vertical -> /Political Vertical & /Political%20Vertical
-          if (existingPath.includes('/political-vertical')) {
-            const afterFolder = existingPath.split('/political-vertical')[1];
-            
-            if (afterFolder && afterFolder !== '/') {
-              const pathParts = afterFolder.split('/').filter(p => p);
-              const pascalParts = pathParts.map(toPascalCase);
-              const pascalPath = '/' + pascalParts.join('/') + '/';
-              
-              redirects.push(
-                '/Political Vertical' + pascalPath,
-                '/Political%20Vertical' + pascalPath
-              );
-            } else {
-              redirects.push(
-                '/Political Vertical/',
-                '/Political%20Vertical/'
-              );
-            }
-          }
-          
-          // Quickstart Guides: /quickstart-guides -> /Quickstart Guides & /Quickstart%20Guides
-          if (existingPath.includes('/quickstart-guides')) {
-            const afterFolder = existingPath.split('/quickstart-guides')[1];
-            
-            if (afterFolder && afterFolder !== '/') {
-              const pathParts = afterFolder.split('/').filter(p => p);
-              const pascalParts = pathParts.map(toPascalCase);
-              const pascalPath = '/' + pascalParts.join('/') + '/';
-              
-              redirects.push(
-                '/Quickstart Guides' + pascalPath,
-                '/Quickstart%20Guides' + pascalPath
-              );
-            } else {
-              redirects.push(
-                '/Quickstart Guides/',
-                '/Quickstart%20Guides/'
-              );
-            }
-          }
-          
-          // Migration Guides: /migration-guides -> /Migration Guides & /Migration%20Guides
-          if (existingPath.includes('/migration-guides')) {
-            const afterFolder = existingPath.split('/migration-guides')[1];
-            
-            if (afterFolder && afterFolder !== '/') {
-              const pathParts = afterFolder.split('/').filter(p => p);
-              const pascalParts = pathParts.map(toPascalCase);
-              const pascalPath = '/' + pascalParts.join('/') + '/';
-              
-              redirects.push(
-                '/Migration Guides' + pascalPath,
-                '/Migration%20Guides' + pascalPath
-              );
-            } else {
-              redirects.push(
-                '/Migration Guides/',
-                '/Migration%20Guides/'
-              );
-            }
-          }
-          
-          // Return unique redirects only
-          return redirects.length > 0 ? [...new Set(redirects)] : undefined;
-        },
-      }
-    ]
+    // Self-hosted fonts: @font-face with font-display, WOFF2 subsets and preloads
+    "./plugins/fonts",
+    // Hashed, per-tag and pre-compressed copies of static/openapi + manifest
+    "./plugins/openapi/artifacts",
+    // Invalidates the persistent webpack cache when remark plugin inputs change
+    "./plugins/webpack-cache",
+    // Partials shared by several pages go to shared chunks instead of each page
+    "./plugins/shared-partials",
+    // Compiles the section chunks of `lazy_endpoints: true` pages (.docusaurus/lazy-endpoints)
+    "./plugins/lazy-endpoints",
+    // Prism theme colors as CSS variables for build-time highlighted code blocks
+    "./plugins/highlight",
+    // Sharded offline search index over headings, endpoints and property names
+    "./plugins/search",
+    // Field name -> endpoints index for the Field Lookup page
+    "./plugins/field-index",
+    // Per-page critical CSS inlined, full stylesheet deferred; page-only
+    // component CSS kept with its route (before offline, which hashes the HTML)
+    "./plugins/critical-css",
+    // Service worker precaching the guidelines, fonts and OpenAPI specs (opt-in)
+    "./plugins/offline",
+    // Legacy URL redirects from plugins/redirects/rules.js: redirects.json,
+    // `_redirects` and, for GitHub Pages, HTML stubs
+    ["./plugins/redirects", {stubs: process.env.REDIRECT_STUBS !== "false"}],
   ]
 };
 
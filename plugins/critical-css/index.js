@@ -0,0 +1,179 @@
+/**
+ * Docusaurus plugin that shrinks the CSS each page blocks rendering on.
+ *
+ * Docusaurus extracts all CSS into a single `styles.<hash>.css` loaded by
+ * every page. Two changes:
+ *
+ * - CSS modules of components only rendered by a few pages
+ *   (`ROUTE_SCOPED_COMPONENTS`) stay in those pages' chunks instead of the
+ *   global stylesheet, and load with the route.
+ * - After the build, each page gets the rules of the global stylesheet that
+ *   can apply to its HTML inlined in a `<style>` (rules whose selectors
+ *   need a class the page doesn't have are pruned); the full stylesheet
+ *   still loads, without blocking first paint, for client-side navigation
+ *   and for states added by scripts.
+ */
+
+const fs = require('fs');
+const path = require('path');
+
+// src/components/* only rendered by the pages that import them
+const ROUTE_SCOPED_COMPONENTS = ['PartnershipBanner', 'IntegrationInquiry', 'FieldLookup', 'OfflineAccess'];
+const ROUTE_SCOPED = new RegExp(`[\\\\/]src[\\\\/]components[\\\\/](${ROUTE_SCOPED_COMPONENTS.join('|')})[\\\\/]`);
+// At-rules whose body holds rules that can be pruned
+const GROUPING_AT_RULE = /^@(media|supports|layer|container)\b/i;
+const STYLESHEET_LINK = /<link rel="stylesheet" href="([^"]+\.css)">/;
+
+/** Index of the `}` closing the block opened at `open`, skipping strings and comments */
+function blockEnd(css, open) {
+  let depth = 0;
+  for (let i = open; i < css.length; i++) {
+    const char = css[i];
+    if (char === '"' || char === "'") {
+      i = css.indexOf(char, i + 1);
+      if (i === -1) return css.length;
+    } else if (char === '/' && css[i + 1] === '*') {
+      i = css.indexOf('*/', i + 2) + 1;
+      if (i === 0) return css.length;
+    } else if (char === '{') {
+      depth += 1;
+    } else if (char === '}') {
+      depth -= 1;
+      if (depth === 0) return i;
+    }
+  }
+  return css.length;
+}
+
+/** Top-level rules of a stylesheet: `{prelude, body}` or `{prelude, children}` */
+function parseRules(css) {
+  const rules = [];
+  let i = 0;
+  while (i < css.length) {
+    const open = css.indexOf('{', i);
+    const semicolon = css.indexOf(';', i);
+    // Statement at-rules (@charset, @import)
+    if (semicolon !== -1 && (open === -1 || semicolon < open) && css.slice(i, semicolon).trim().startsWith('@')) {
+      rules.push({prelude: css.slice(i, semicolon + 1).trim(), statement: true});
+      i = semicolon + 1;
+      continue;
+    }
+    if (open === -1) break;
+    const close = blockEnd(css, open);
+    const prelude = css.slice(i, open).replace(/\/\*[\s\S]*?\*\//g, '').trim();
+    const body = css.slice(open + 1, close);
+    rules.push(GROUPING_AT_RULE.test(prelude) ? {prelude, children: parseRules(body)} : {prelude, body});
+    i = close + 1;
+  }
+  return rules;
+}
+
+/** Splits a selector list on its top-level commas */
+function splitSelectors(selectorList) {
+  const selectors = [];
+  let depth = 0;
+  let start = 0;
+  for (let i = 0; i < selectorList.length; i++) {
+    const char = selectorList[i];
+    if (char === '(' || char === '[') depth += 1;
+    else if (char === ')' || char === ']') depth -= 1;
+    else if (char === ',' && depth === 0) {
+      selectors.push(selectorList.slice(start, i));
+      start = i + 1;
+    }
+  }
+  selectors.push(selectorList.slice(start));
+  return selectors;
+}
+
+/** Classes an element needs for `selector` to match; functional pseudo-classes are not required */
+function requiredClasses(selector) {
+  let plain = selector.replace(/\[[^\]]*\]/g, '');
+  // Innermost first, for nested :not(:is(...))
+  while (/:(not|is|where|has|matches|-webkit-any)\([^()]*\)/.test(plain)) {
+    plain = plain.replace(/:(not|is|where|has|matches|-webkit-any)\([^()]*\)/g, '');
+  }
+  return [...plain.matchAll(/\.(-?[_a-zA-Z][\w-]*)/g)].map((match) => match[1]);
+}
+
+function pruneRules(rules, classes) {
+  const output = [];
+  for (const rule of rules) {
+    if (rule.statement) {
+      // @charset is only valid at the start of a stylesheet file
+      if (!/^@charset\b/i.test(rule.prelude)) output.push(rule.prelude);
+    } else if (rule.children) {
+      const children = pruneRules(rule.children, classes);
+      if (children) output.push(`${rule.prelude}{${children}}`);
+    } else if (rule.prelude.startsWith('@')) {
+      // @font-face, @keyframes, @page, ...
+      output.push(`${rule.prelude}{${rule.body}}`);
+    } else {
+      const kept = splitSelectors(rule.prelude).filter((selector) =>
+        requiredClasses(selector).every((name) => classes.has(name)),
+      );
+      if (kept.length) output.push(`${kept.join(',')}{${rule.body}}`);
+    }
+  }
+  return output.join('');
+}
+
+function pageClasses(html) {
+  const classes = new Set();
+  for (const [, value] of html.matchAll(/\sclass="([^"]*)"/g)) {
+    for (const name of value.split(/\s+/)) if (name) classes.add(name);
+  }
+  return classes;
+}
+
+module.exports = function criticalCssPlugin(context) {
+  const {baseUrl} = context.siteConfig;
+
+  return {
+    name: 'critical-css',
+
+    configureWebpack(config, isServer) {
+      if (isServer) return {};
+      return {
+        optimization: {
+          splitChunks: {
+            cacheGroups: {
+              // Docusaurus' single-stylesheet group
+              styles: {
+                test: (module) => !ROUTE_SCOPED.test(module.identifier()),
+              },
+            },
+          },
+        },
+      };
+    },
+
+    async postBuild({outDir}) {
+      const stylesheets = new Map();
+      const pages = fs
+        .readdirSync(outDir, {recursive: true})
+        .filter((name) => name.endsWith('.html'));
+
+      for (const page of pages) {
+        const filePath = path.join(outDir, page);
+        const html = fs.readFileSync(filePath, 'utf8');
+        const link = html.match(STYLESHEET_LINK);
+        if (!link || !link[1].startsWith(baseUrl)) continue;
+        const href = link[1];
+        if (!stylesheets.has(href)) {
+          const cssPath = path.join(outDir, href.slice(baseUrl.length));
+          stylesheets.set(href, fs.existsSync(cssPath) ? parseRules(fs.readFileSync(cssPath, 'utf8')) : null);
+        }
+        const rules = stylesheets.get(href);
+        if (!rules) continue;
+
+        const critical = pruneRules(rules, pageClasses(html)).replace(/<\/style/gi, '<\\/style');
+        const deferred =
+          `<style data-critical>${critical}</style>` +
+          `<link rel="stylesheet" href="${href}" media="print" onload="this.media='all'">` +
+          `<noscript><link rel="stylesheet" href="${href}"></noscript>`;
+        fs.writeFileSync(filePath, html.replace(link[0], () => deferred));
+      }
+    },
+  };
+};
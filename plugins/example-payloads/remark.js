@@ -0,0 +1,235 @@
+/**
+ * Remark plugin that moves large example responses out of the page.
+ *
+ * Opt in per page with front matter:
+ *
+ *   ---
+ *   example_payloads: true
+ *   ---
+ *
+ * Every ```json block titled `Response ...` (or untitled) of at least
+ * `minSize` characters that parses as JSON is written to
+ * `.docusaurus/example-payloads/` and replaced with
+ *
+ *   <ExamplePayload title="Response 200" bytes={5829} entries={3}
+ *     src={new URL('../../.docusaurus/example-payloads/<page>/<n>.json', import.meta.url).pathname} />
+ *
+ * webpack emits the JSON as a hashed static asset, which the component only
+ * fetches when the reader expands the example. Request samples and short
+ * responses stay inline, as do blocks that aren't plain JSON once their
+ * `// highlight-next-line` comments are removed; those comments become
+ * `highlight={["/data/0/id"]}` JSON pointers the viewer expands to and marks.
+ *
+ * Each page's payloads are rewritten when the page is compiled, and the
+ * ones it no longer produces are deleted.
+ */
+
+const path = require('path');
+const {
+  DEFAULT_GENERATED_FILES_DIR,
+  DEFAULT_DOCS_DIR,
+  isOptedIn,
+  pageDirOf,
+  writeIfChanged,
+  removeStale,
+  expressionAttribute,
+} = require('../lib/generated-files');
+
+const OUT_DIR_NAME = 'example-payloads';
+const DEFAULT_MIN_SIZE = 400;
+const FRONT_MATTER_KEY = 'example_payloads';
+const RESPONSE_TITLE = /^Response\b/i;
+const HIGHLIGHT_COMMENT = /^\s*\/\/\s*highlight-next-line\s*$/;
+
+/** Title of a fence, tolerating the `title=Response 200"` typos found in the docs */
+function titleOf(meta) {
+  const match = (meta || '').match(/\btitle[=-]\s*(["']?)([^"']*)\1?/);
+  return match ? match[2].trim() : undefined;
+}
+
+function parseJson(value) {
+  try {
+    return JSON.parse(value);
+  } catch {
+    return undefined;
+  }
+}
+
+const pointerSegment = (key) => String(key).replace(/~/g, '~0').replace(/\//g, '~1');
+
+/**
+ * Line (0-based) -> JSON pointer of the member or array item starting on
+ * it, for valid JSON `text`
+ */
+function linePointers(text) {
+  const pointers = new Map();
+  let index = 0;
+  let line = 0;
+  const skipSpace = () => {
+    while (/\s/.test(text[index] || '')) {
+      if (text[index] === '\n') line += 1;
+      index += 1;
+    }
+  };
+  const readString = () => {
+    const start = index;
+    for (index += 1; text[index] !== '"'; index += 1) if (text[index] === '\\') index += 1;
+    index += 1;
+    return JSON.parse(text.slice(start, index));
+  };
+  const readValue = (pointer) => {
+    skipSpace();
+    const char = text[index];
+    if (char === '{' || char === '[') {
+      const isObject = char === '{';
+      index += 1;
+      for (let item = 0; ; item += 1) {
+        skipSpace();
+        if (text[index] === (isObject ? '}' : ']')) break;
+        const itemLine = line;
+        let key = item;
+        if (isObject) {
+          key = readString();
+          skipSpace();
+          index += 1; // :
+        }
+        const itemPointer = `${pointer}/${pointerSegment(key)}`;
+        if (!pointers.has(itemLine)) pointers.set(itemLine, itemPointer);
+        readValue(itemPointer);
+        skipSpace();
+        if (text[index] === ',') index += 1;
+      }
+      index += 1;
+    } else if (char === '"') {
+      readString();
+    } else {
+      while (index < text.length && !/[\s,\]}]/.test(text[index])) index += 1;
+    }
+  };
+  readValue('');
+  return pointers;
+}
+
+/** `{json, highlight}` of a block with its highlight comments removed */
+function stripHighlights(value) {
+  const lines = [];
+  const marked = [];
+  for (const line of value.split('\n')) {
+    if (HIGHLIGHT_COMMENT.test(line)) marked.push(lines.length);
+    else lines.push(line);
+  }
+  const json = lines.join('\n');
+  if (!marked.length) return {json, highlight: []};
+  const pointers = linePointers(json);
+  return {json, highlight: marked.map((line) => pointers.get(line)).filter(Boolean)};
+}
+
+function literal(value) {
+  return {type: 'Literal', value, raw: JSON.stringify(value)};
+}
+
+/** `src={new URL(request, import.meta.url).pathname}`: webpack emits `request` as an asset */
+function assetUrlAttribute(request) {
+  const identifier = (name) => ({type: 'Identifier', name});
+  return expressionAttribute('src', `new URL(${JSON.stringify(request)}, import.meta.url).pathname`, {
+    type: 'MemberExpression',
+    computed: false,
+    optional: false,
+    object: {
+      type: 'NewExpression',
+      callee: identifier('URL'),
+      arguments: [
+        literal(request),
+        {
+          type: 'MemberExpression',
+          computed: false,
+          optional: false,
+          object: {type: 'MetaProperty', meta: identifier('import'), property: identifier('meta')},
+          property: identifier('url'),
+        },
+      ],
+    },
+    property: identifier('pathname'),
+  });
+}
+
+function numberAttribute(name, value) {
+  return expressionAttribute(name, String(value), literal(value));
+}
+
+/** `name={["a", "b"]}` */
+function arrayAttribute(name, values) {
+  return expressionAttribute(name, JSON.stringify(values), {
+    type: 'ArrayExpression',
+    elements: values.map(literal),
+  });
+}
+
+/** Top-level entry count shown while the example is collapsed */
+function sizeOf(value) {
+  if (Array.isArray(value)) return value.length;
+  return value && typeof value === 'object' ? Object.keys(value).length : 0;
+}
+
+function transform(parent, visit) {
+  if (!parent.children) return;
+  parent.children.forEach((child, index) => {
+    const replacement = visit(child);
+    if (replacement) parent.children[index] = replacement;
+    else transform(child, visit);
+  });
+}
+
+module.exports = function remarkExamplePayloads(options = {}) {
+  const outDir = path.join(options.generatedFilesDir || DEFAULT_GENERATED_FILES_DIR, OUT_DIR_NAME);
+  const docsDir = options.docsDir || DEFAULT_DOCS_DIR;
+  const minSize = options.minSize || DEFAULT_MIN_SIZE;
+
+  return (tree, file) => {
+    // Not the chunks of plugins/lazy-endpoints, which are outside the docs
+    if (!file.path || !file.path.startsWith(docsDir)) {
+      return;
+    }
+    const pageDir = pageDirOf(docsDir, file.path);
+    const written = new Set();
+    if (!isOptedIn(file, FRONT_MATTER_KEY)) {
+      removeStale(path.join(outDir, pageDir), written);
+      return;
+    }
+    let count = 0;
+
+    transform(tree, (node) => {
+      if (node.type !== 'code' || (node.lang || '').toLowerCase() !== 'json') return undefined;
+      const title = titleOf(node.meta);
+      if ((title && !RESPONSE_TITLE.test(title)) || node.value.length < minSize) return undefined;
+      const {json, highlight} = stripHighlights(node.value);
+      const payload = parseJson(json);
+      if (payload === undefined) return undefined;
+
+      count += 1;
+      const filePath = path.join(outDir, pageDir, `${count}.json`);
+      // Kept as authored: the viewer copies it verbatim
+      writeIfChanged(filePath, `${json.replace(/\n$/, '')}\n`);
+      written.add(`${count}.json`);
+      let request = path.relative(path.dirname(file.path), filePath).split(path.sep).join('/');
+      if (!request.startsWith('.')) request = `./${request}`;
+
+      return {
+        type: 'mdxJsxFlowElement',
+        name: 'ExamplePayload',
+        attributes: [
+          ...(title ? [{type: 'mdxJsxAttribute', name: 'title', value: title}] : []),
+          numberAttribute('bytes', Buffer.byteLength(json)),
+          numberAttribute('entries', sizeOf(payload)),
+          ...(highlight.length ? [arrayAttribute('highlight', highlight)] : []),
+          assetUrlAttribute(request),
+        ],
+        children: [],
+        position: node.position,
+      };
+    });
+    removeStale(path.join(outDir, pageDir), written);
+  };
+};
+
+module.exports.OUT_DIR_NAME = OUT_DIR_NAME;
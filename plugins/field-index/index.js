@@ -0,0 +1,166 @@
+/**
+ * Docusaurus plugin that builds an inverted index from field name to every
+ * endpoint that takes or returns it, for src/components/FieldLookup.
+ *
+ * Fields come from `static/openapi/openapi.json` (parameters, request
+ * bodies and success responses, nested objects flattened) and from the
+ * property tables of the docs (see plugins/sidebar/outline). Each endpoint
+ * links to the docs section that documents it, when there is one.
+ *
+ * The index is written after the build to `search/fields.<hash>.json`:
+ *
+ *   {
+ *     "endpoints": [[method, path, api, title, docsUrl | null], ...],
+ *     "fields": {"owid": ["owId", [[endpoint, where, dottedPath?], ...]], ...}
+ *   }
+ *
+ * Keys are lowercased field names, so a lookup is a single property access.
+ * `where` is one of `WHERE` below. The URL is exposed to the client as
+ * plugin global data.
+ */
+
+const crypto = require('crypto');
+const fs = require('fs');
+const path = require('path');
+const {docRoutes, routeOutline} = require('../sidebar/outline');
+const {
+  DEFAULT_API_ORIGIN,
+  loadSpec,
+  listOperations,
+  operationKey,
+  normalizeSchema,
+  flattenProperties,
+  jsonContent,
+  unwrapEnvelope,
+  successResponse,
+  documentedParameters,
+} = require('../openapi/lib/spec');
+
+const OUTPUT_DIR = 'search';
+const HASH_LENGTH = 10;
+
+// Where an endpoint uses a field
+const WHERE = {
+  path: 'p',
+  query: 'q',
+  header: 'h',
+  body: 'b',
+  response: 'r',
+  // Listed in a docs table only
+  docs: 'd',
+};
+
+const leafName = (name) => name.split('.').pop();
+
+// Docs and spec don't always name path parameters alike
+const matchKey = (method, apiPath) => operationKey(method, apiPath.replace(/\{[^}]*\}/g, '{}'));
+
+// trailingSlash: true
+const docsUrl = (baseUrl, route, id) => `${baseUrl}${route.replace(/^\/+/, '')}${route === '/' ? '' : '/'}#${id}`;
+
+function buildIndex({baseUrl, docsDir}) {
+  const spec = loadSpec();
+  const endpoints = [];
+  const endpointIndex = new Map();
+  const fields = new Map();
+  const postingKeys = new Set();
+  const specFields = new Set();
+
+  const endpointOf = (key, record) => {
+    if (!endpointIndex.has(key)) {
+      endpointIndex.set(key, endpoints.length);
+      endpoints.push(record);
+    }
+    return endpointIndex.get(key);
+  };
+
+  const addField = (name, endpoint, where) => {
+    const leaf = leafName(name);
+    if (!/^[A-Za-z_$][\w$]*$/.test(leaf)) return;
+    const key = leaf.toLowerCase();
+    const postingKey = `${key} ${endpoint} ${where} ${name}`;
+    if (postingKeys.has(postingKey)) return;
+    postingKeys.add(postingKey);
+    if (!fields.has(key)) fields.set(key, [leaf, []]);
+    fields.get(key)[1].push(name === leaf ? [endpoint, where] : [endpoint, where, name]);
+  };
+
+  // Docs sections documenting an endpoint, by `METHOD /path`
+  const sections = new Map();
+  for (const route of docRoutes({docsDir})) {
+    const {title, entries} = routeOutline(route, {docsDir});
+    for (const entry of entries) {
+      if (!entry.method || !entry.url) continue;
+      const apiPath = entry.url.replace(DEFAULT_API_ORIGIN, '').replace(/\?.*$/, '');
+      const key = matchKey(entry.method, apiPath);
+      if (!sections.has(key)) sections.set(key, {route, title, entry, apiPath});
+    }
+  }
+
+  for (const operation of listOperations(spec)) {
+    const key = matchKey(operation.method, operation.path);
+    const section = sections.get(key);
+    const endpoint = endpointOf(key, [
+      operation.method,
+      operation.path,
+      operation.tags[0] || (section && section.title) || '',
+      operation.summary || (section && section.entry.text) || '',
+      section ? docsUrl(baseUrl, section.route, section.entry.id) : null,
+    ]);
+    const add = (name, where) => {
+      specFields.add(`${endpoint} ${leafName(name).toLowerCase()}`);
+      addField(name, endpoint, where);
+    };
+
+    for (const param of documentedParameters(spec, operation.parameters)) {
+      if (WHERE[param.in]) add(param.name, WHERE[param.in]);
+    }
+    const body = operation.operation.requestBody && jsonContent(operation.operation.requestBody.content);
+    if (body && body.schema) {
+      for (const row of flattenProperties(spec, normalizeSchema(spec, body.schema))) add(row.name, WHERE.body);
+    }
+    const success = successResponse(operation.operation);
+    const media = success && jsonContent(success.response.content);
+    if (media && media.schema) {
+      for (const row of flattenProperties(spec, unwrapEnvelope(spec, media.schema))) add(row.name, WHERE.response);
+    }
+  }
+
+  // Fields the docs list that the spec doesn't describe for that endpoint
+  for (const [key, {route, title, entry, apiPath}] of sections) {
+    const endpoint = endpointOf(key, [entry.method, apiPath, title || '', entry.text, docsUrl(baseUrl, route, entry.id)]);
+    for (const name of entry.properties) {
+      if (!specFields.has(`${endpoint} ${leafName(name).toLowerCase()}`)) addField(name, endpoint, WHERE.docs);
+    }
+  }
+
+  return {endpoints, fields: Object.fromEntries([...fields].sort(([a], [b]) => a.localeCompare(b)))};
+}
+
+module.exports = function fieldIndexPlugin(context, options = {}) {
+  const {baseUrl} = context.siteConfig;
+  const docsDir = options.docsDir || path.join(context.siteDir, 'docs');
+  let output;
+
+  return {
+    name: 'field-index',
+
+    async loadContent() {
+      const buffer = Buffer.from(JSON.stringify(buildIndex({baseUrl, docsDir})));
+      const hash = crypto.createHash('sha256').update(buffer).digest('hex').slice(0, HASH_LENGTH);
+      output = {buffer, fileName: `fields.${hash}.json`};
+      return {url: `${baseUrl}${OUTPUT_DIR}/${output.fileName}`};
+    },
+
+    async contentLoaded({content, actions}) {
+      actions.setGlobalData(content);
+    },
+
+    async postBuild({outDir}) {
+      fs.mkdirSync(path.join(outDir, OUTPUT_DIR), {recursive: true});
+      fs.writeFileSync(path.join(outDir, OUTPUT_DIR, output.fileName), output.buffer);
+    },
+  };
+};
+
+module.exports.buildIndex = buildIndex;
@@ -0,0 +1,74 @@
+/**
+ * Docusaurus plugin that declares the self-hosted fonts.
+ *
+ * The `@font-face` rules are injected into every page's `<head>` with
+ * `font-display: swap`, so text renders in the fallback font instead of
+ * waiting for the download. Each rule prefers the subset WOFF2 written by
+ * `scripts/subset-fonts.sh` and falls back to the original `.otf` when the
+ * subset hasn't been generated (e.g. a local `npm start`).
+ *
+ * Fonts marked `preload` are used above the fold (inline `code` and the
+ * sidebar method badges) and get a `<link rel="preload">`, but only as
+ * WOFF2: preloading a multi-megabyte `.otf` would hold up first paint.
+ */
+
+const fs = require('fs');
+const path = require('path');
+
+const FONTS_DIR = path.resolve(__dirname, '../../static/fonts');
+const SUBSET_DIR = 'subset';
+
+const FONTS = [
+  {family: 'avenir', file: 'avenir/AvenirLTProLight'},
+  {family: 'avenirMed', file: 'avenir/AvenirLTProMedium', preload: true},
+  {family: 'avenirRom', file: 'avenir/AvenirLTProRoman'},
+  {family: 'argon', file: 'argon/Argon-Regular', preload: true},
+  {family: 'argonWide', file: 'argon/Argon-Regular-semiwide'},
+];
+
+/** `avenir/AvenirLTProLight` -> `avenir/subset/AvenirLTProLight.woff2` */
+function subsetPath(file) {
+  return path.posix.join(path.posix.dirname(file), SUBSET_DIR, `${path.posix.basename(file)}.woff2`);
+}
+
+module.exports = function fontsPlugin(context) {
+  const {baseUrl} = context.siteConfig;
+  const fontUrl = (file) => `${baseUrl}fonts/${file}`;
+
+  return {
+    name: 'fonts',
+
+    injectHtmlTags() {
+      const fonts = FONTS.map((font) => ({
+        ...font,
+        woff2: fs.existsSync(path.join(FONTS_DIR, subsetPath(font.file))),
+      }));
+
+      const rules = fonts.map(({family, file, woff2}) => {
+        const sources = [`url(${fontUrl(`${file}.otf`)}) format("opentype")`];
+        if (woff2) sources.unshift(`url(${fontUrl(subsetPath(file))}) format("woff2")`);
+        return `@font-face{font-family:"${family}";src:${sources.join(',')};font-display:swap}`;
+      });
+
+      const preloads = fonts
+        .filter(({preload, woff2}) => preload && woff2)
+        .map(({file}) => ({
+          tagName: 'link',
+          attributes: {
+            rel: 'preload',
+            href: fontUrl(subsetPath(file)),
+            as: 'font',
+            type: 'font/woff2',
+            crossorigin: 'anonymous',
+          },
+        }));
+
+      return {
+        headTags: [...preloads, {tagName: 'style', innerHTML: rules.join('\n')}],
+      };
+    },
+  };
+};
+
+module.exports.FONTS = FONTS;
+module.exports.subsetPath = subsetPath;
@@ -0,0 +1,87 @@
+/**
+ * Docusaurus plugin that turns the site's Prism themes
+ * (`themeConfig.prism.theme`/`darkTheme`) into CSS for the code blocks
+ * highlighted at build time by `./remark`:
+ *
+ *   :root                 { --code-token-string-color: #a31515 }
+ *   [data-theme='dark']   { --code-token-string-color: #ce9178 }
+ *   .static-code .token.string { color: var(--code-token-string-color) }
+ *
+ * Switching color mode only swaps the variables: nothing is re-highlighted.
+ * A theme entry for `typescript` also applies to the blocks fenced as `ts`.
+ */
+
+const {aliasesOf} = require('./prism');
+
+const kebab = (value) => value.replace(/[A-Z]/g, (char) => `-${char.toLowerCase()}`);
+
+/** `lang|type` -> style, later theme entries winning as in prism-react-renderer */
+function tokenStyles(theme) {
+  const styles = new Map();
+  for (const {types, languages, style} of (theme && theme.styles) || []) {
+    for (const language of languages || ['']) {
+      for (const type of types) {
+        const key = `${language}|${type}`;
+        styles.set(key, {...styles.get(key), ...style});
+      }
+    }
+  }
+  return styles;
+}
+
+function themeCss(lightTheme, darkTheme) {
+  const themes = {light: lightTheme || {}, dark: darkTheme || lightTheme || {}};
+  const styles = {light: tokenStyles(themes.light), dark: tokenStyles(themes.dark)};
+  const declarations = {light: [], dark: []};
+  const rules = [];
+  const declare = (name, values) => {
+    for (const mode of ['light', 'dark']) {
+      // `initial` makes the property fall back to the plain text color
+      declarations[mode].push(`${name}:${values[mode] === undefined ? 'initial' : values[mode]}`);
+    }
+  };
+
+  declare('--code-plain-color', {light: themes.light.plain?.color, dark: themes.dark.plain?.color});
+  declare('--code-plain-background', {
+    light: themes.light.plain?.backgroundColor,
+    dark: themes.dark.plain?.backgroundColor,
+  });
+  rules.push('.static-code{color:var(--code-plain-color);background-color:var(--code-plain-background)}');
+
+  const keys = [...new Set([...styles.light.keys(), ...styles.dark.keys()])];
+  for (const key of keys) {
+    const [language, type] = key.split('|');
+    const light = styles.light.get(key) || {};
+    const dark = styles.dark.get(key) || {};
+    const properties = [...new Set([...Object.keys(light), ...Object.keys(dark)])];
+    const names = properties.map((property) => {
+      const name = `--code-token-${language ? `${language}-` : ''}${type}-${kebab(property)}`;
+      declare(name, {light: light[property], dark: dark[property]});
+      return `${kebab(property)}:var(${name})`;
+    });
+    const scopes = language ? aliasesOf(language).map((alias) => `.static-code.language-${alias}`) : ['.static-code'];
+    rules.push(`${scopes.map((scope) => `${scope} .token.${type}`).join(',')}{${names.join(';')}}`);
+  }
+
+  return [
+    `:root{${declarations.light.join(';')}}`,
+    `[data-theme='dark']{${declarations.dark.join(';')}}`,
+    ...rules,
+  ].join('\n');
+}
+
+module.exports = function highlightPlugin(context) {
+  const {prism = {}} = context.siteConfig.themeConfig;
+
+  return {
+    name: 'static-highlight',
+
+    injectHtmlTags() {
+      return {
+        headTags: [{tagName: 'style', innerHTML: themeCss(prism.theme, prism.darkTheme)}],
+      };
+    },
+  };
+};
+
+module.exports.themeCss = themeCss;
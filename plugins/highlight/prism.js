@@ -0,0 +1,25 @@
+/**
+ * The Prism bundled in prism-react-renderer, with the grammars it doesn't
+ * bundle that the docs use, registered the way the theme's
+ * `additionalLanguages` does it.
+ */
+
+const {Prism} = require('prism-react-renderer');
+
+// `bash` for the shell samples, `http` for the raw requests
+const ADDITIONAL_LANGUAGES = ['bash', 'http'];
+
+globalThis.Prism = Prism;
+for (const language of ADDITIONAL_LANGUAGES) {
+  require(`prismjs/components/prism-${language}`);
+}
+delete globalThis.Prism;
+
+/** `typescript` -> ['typescript', 'ts']: the names Prism registers its grammar under */
+function aliasesOf(language) {
+  const grammar = Prism.languages[language];
+  if (!grammar || typeof grammar !== 'object') return [language];
+  return Object.keys(Prism.languages).filter((name) => Prism.languages[name] === grammar);
+}
+
+module.exports = {Prism, aliasesOf};
@@ -0,0 +1,100 @@
+/**
+ * Remark plugin that highlights fenced code blocks at compile time.
+ *
+ * Each block is tokenized with the Prism bundled in prism-react-renderer
+ * (the one the theme's `<CodeBlock>` uses at runtime, plus the grammars of
+ * `./prism`) and replaced with
+ *
+ *   <StaticCodeBlock language="json" title="..." types="property|operator|number" tokens='<a"id"><b:> <c1>' />
+ *
+ * `tokens` is the HTML-escaped code in which each token is `<` + the letter
+ * of its types in `types` + its text + `>`; `<StaticCodeBlock>` expands it
+ * to spans carrying Prism's token classes, whose colors come from the CSS
+ * variables emitted by `./index`. Shipping the spans themselves would make
+ * the JSON samples of a page 6 times bigger. The page no longer tokenizes
+ * its samples while it hydrates, and color mode switches without
+ * re-highlighting.
+ *
+ * Blocks are left to the runtime `<CodeBlock>` when Prism has no grammar
+ * for their language or when they use features only it implements: line
+ * highlighting (`{1,4-6}`, `// highlight-next-line`), `showLineNumbers`
+ * and `live`.
+ */
+
+const {normalizeTokens} = require('prism-react-renderer');
+const {Prism} = require('./prism');
+
+const RUNTIME_META = /\{[\d,\s-]+\}|\bshowLineNumbers\b|\blive\b/;
+const MAGIC_COMMENT = /highlight-(next-line|start|end)\b/;
+// Letters of the token types of a block, decoded by <StaticCodeBlock>
+const TYPE_CODES = 'abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789';
+
+const escapeHtml = (value) => value.replace(/&/g, '&amp;').replace(/</g, '&lt;').replace(/>/g, '&gt;');
+
+function titleOf(meta) {
+  const match = (meta || '').match(/\btitle=(["'])(.*?)\1/);
+  return match ? match[2] : undefined;
+}
+
+/**
+ * `{types, tokens}` of the highlighted code, or undefined when Prism can't
+ * highlight `language` (or the block has more token types than letters)
+ */
+function highlight(code, language) {
+  const grammar = Prism.languages[language];
+  if (!grammar) return undefined;
+  const types = [];
+  const codeOf = (type) => {
+    let index = types.indexOf(type);
+    if (index === -1) index = types.push(type) - 1;
+    return TYPE_CODES[index];
+  };
+  const tokens = normalizeTokens(Prism.tokenize(code, grammar))
+    .map((line) =>
+      line
+        .map((token) => {
+          const content = token.empty ? '' : escapeHtml(token.content);
+          const type = token.types.filter((name) => name !== 'plain').join(' ');
+          return type && content ? `<${codeOf(type)}${content}>` : content;
+        })
+        .join(''),
+    )
+    .join('\n');
+  return types.length > TYPE_CODES.length ? undefined : {types: types.join('|'), tokens};
+}
+
+function transform(parent, visit) {
+  if (!parent.children) return;
+  parent.children.forEach((child, index) => {
+    const replacement = visit(child);
+    if (replacement) parent.children[index] = replacement;
+    else transform(child, visit);
+  });
+}
+
+module.exports = function remarkStaticHighlight() {
+  return (tree) => {
+    transform(tree, (node) => {
+      if (node.type !== 'code' || !node.lang) return undefined;
+      const meta = (node.meta || '').replace(/\btitle=(["']).*?\1/, '');
+      if (RUNTIME_META.test(meta) || MAGIC_COMMENT.test(node.value)) return undefined;
+      const language = node.lang.toLowerCase();
+      const highlighted = highlight(node.value.replace(/\n$/, ''), language);
+      if (highlighted === undefined) return undefined;
+
+      const title = titleOf(node.meta);
+      return {
+        type: 'mdxJsxFlowElement',
+        name: 'StaticCodeBlock',
+        attributes: [
+          {type: 'mdxJsxAttribute', name: 'language', value: language},
+          ...(title ? [{type: 'mdxJsxAttribute', name: 'title', value: title}] : []),
+          {type: 'mdxJsxAttribute', name: 'types', value: highlighted.types},
+          {type: 'mdxJsxAttribute', name: 'tokens', value: highlighted.tokens},
+        ],
+        children: [],
+        position: node.position,
+      };
+    });
+  };
+};
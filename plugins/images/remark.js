@@ -0,0 +1,153 @@
+/**
+ * Remark plugin for the screenshots imported into MDX pages:
+ *
+ *   import Step1 from '@site/static/img/partnerships/hubspot/step1.png';
+ *   <img className='diagram' src={Step1} />
+ *
+ * Every `<img>` whose `src` is such an import (or a `/img/...` path) gets
+ * its intrinsic `width` and `height` (so the page doesn't shift as images
+ * load), `loading="lazy"` and `decoding="async"`. When `scripts/optimize-images.js` has generated AVIF and
+ * WebP variants, the image is wrapped in a `<picture>` that offers them via
+ * `srcSet`; the imported PNG stays as the fallback.
+ *
+ * `<ImageLightbox>` gets the same variants as `srcSetAvif`/`srcSetWebp`, so
+ * its thumbnail loads a small variant and the full-size file is only
+ * fetched when the lightbox opens.
+ */
+
+const fs = require('fs');
+const path = require('path');
+const {imageSize} = require('image-size');
+const {srcSets, variantFiles} = require('./variants');
+const {setDependencies} = require('../lib/module-dependencies');
+
+const IMAGE_IMPORT = /import\s+(\w+)\s+from\s+['"]([^'"]+\.(?:png|jpe?g))['"]/g;
+const LIGHTBOX_TAGS = new Set(['ImageLightbox', 'ImageLightBox']);
+const DEFAULT_SIZES = '(max-width: 996px) 100vw, 40rem';
+
+function resolveSource(source, file, siteDir) {
+  if (source.startsWith('@site/')) return path.join(siteDir, source.slice('@site/'.length));
+  if (source.startsWith('.')) return path.resolve(path.dirname(file.path), source);
+  return undefined;
+}
+
+/** Identifier -> file path for each image imported by the page */
+function imageImports(tree, file, siteDir) {
+  const images = new Map();
+  for (const node of tree.children) {
+    if (node.type !== 'mdxjsEsm') continue;
+    for (const [, name, source] of node.value.matchAll(IMAGE_IMPORT)) {
+      const resolved = resolveSource(source, file, siteDir);
+      if (resolved && fs.existsSync(resolved)) images.set(name, resolved);
+    }
+  }
+  return images;
+}
+
+const sizeCache = new Map();
+
+function dimensionsOf(filePath) {
+  const {mtimeMs} = fs.statSync(filePath);
+  const cached = sizeCache.get(filePath);
+  if (cached && cached.mtimeMs === mtimeMs) return cached.size;
+  const {width, height} = imageSize(fs.readFileSync(filePath));
+  sizeCache.set(filePath, {mtimeMs, size: {width, height}});
+  return {width, height};
+}
+
+function attribute(node, name) {
+  return (node.attributes || []).find((attr) => attr.type === 'mdxJsxAttribute' && attr.name === name);
+}
+
+function setDefault(node, name, value) {
+  if (!attribute(node, name)) {
+    node.attributes.push({type: 'mdxJsxAttribute', name, value: String(value)});
+  }
+}
+
+/** File behind an attribute written as `{ImportedName}` or as a `/img/...` static path */
+function imageFile(node, name, images, siteDir) {
+  const attr = attribute(node, name);
+  const value = attr && attr.value;
+  if (typeof value === 'string') {
+    const staticPath = path.join(siteDir, 'static', value);
+    return value.startsWith('/') && /\.(png|jpe?g)$/.test(value) && fs.existsSync(staticPath)
+      ? staticPath
+      : undefined;
+  }
+  if (!value || value.type !== 'mdxJsxAttributeValueExpression') return undefined;
+  return images.get(value.value.trim());
+}
+
+function pictureOf(img, sets) {
+  const sizes = (attribute(img, 'sizes') || {}).value || DEFAULT_SIZES;
+  const source = (format) => ({
+    type: img.type,
+    name: 'source',
+    attributes: [
+      {type: 'mdxJsxAttribute', name: 'type', value: `image/${format}`},
+      {type: 'mdxJsxAttribute', name: 'srcSet', value: sets[format]},
+      {type: 'mdxJsxAttribute', name: 'sizes', value: sizes},
+    ],
+    children: [],
+  });
+  return {type: img.type, name: 'picture', attributes: [], children: [source('avif'), source('webp'), img]};
+}
+
+function transform(parent, visit) {
+  if (!parent.children) return;
+  parent.children.forEach((child, index) => {
+    const replacement = visit(child);
+    if (replacement) parent.children[index] = replacement;
+    else transform(child, visit);
+  });
+}
+
+module.exports = function remarkImages(options = {}) {
+  const siteDir = options.siteDir || path.resolve(__dirname, '../..');
+  const baseUrl = options.baseUrl || '/';
+
+  return (tree, file) => {
+    if (!file.path) return;
+    const images = imageImports(tree, file, siteDir);
+    // The screenshots measured and the variants looked for
+    const read = new Set();
+    const measure = (imagePath) => {
+      const size = dimensionsOf(imagePath);
+      read.add(imagePath);
+      for (const variant of variantFiles(imagePath, size.width)) read.add(variant);
+      return size;
+    };
+
+    transform(tree, (node) => {
+      if (node.type !== 'mdxJsxFlowElement' && node.type !== 'mdxJsxTextElement') return undefined;
+
+      if (node.name === 'img') {
+        const imagePath = imageFile(node, 'src', images, siteDir);
+        if (!imagePath) return undefined;
+        const {width, height} = measure(imagePath);
+        setDefault(node, 'width', width);
+        setDefault(node, 'height', height);
+        setDefault(node, 'loading', 'lazy');
+        setDefault(node, 'decoding', 'async');
+        const sets = srcSets(imagePath, width, baseUrl);
+        return sets ? pictureOf(node, sets) : undefined;
+      }
+
+      if (LIGHTBOX_TAGS.has(node.name)) {
+        const imagePath = imageFile(node, 'full', images, siteDir) || imageFile(node, 'thumb', images, siteDir);
+        if (!imagePath) return undefined;
+        const {width, height} = measure(imagePath);
+        setDefault(node, 'width', width);
+        setDefault(node, 'height', height);
+        const sets = srcSets(imagePath, width, baseUrl);
+        if (sets) {
+          setDefault(node, 'srcSetAvif', sets.avif);
+          setDefault(node, 'srcSetWebp', sets.webp);
+        }
+      }
+      return undefined;
+    });
+    setDependencies(file, 'images', read);
+  };
+};
@@ -0,0 +1,71 @@
+/**
+ * Where responsive variants of `static/img` live and which ones exist.
+ * Shared by `scripts/optimize-images.js`, which writes them, and the remark
+ * plugin, which references them.
+ */
+
+const fs = require('fs');
+const path = require('path');
+
+const SITE_DIR = path.resolve(__dirname, '../..');
+const SOURCE_DIR = path.join(SITE_DIR, 'static/img');
+// Served at /img-variants/, next to the originals under /img/
+const OUTPUT_DIR = path.join(SITE_DIR, 'static/img-variants');
+const OUTPUT_URL = '/img-variants';
+
+// `.diagram` screenshots display at 40rem: 1x, 1.5x and 2x of that
+const WIDTHS = [640, 960, 1280];
+const FORMATS = ['avif', 'webp'];
+
+/** Widths to generate for an image `intrinsicWidth` px wide (never upscaled) */
+function targetWidths(intrinsicWidth) {
+  const widths = WIDTHS.filter((width) => width < intrinsicWidth);
+  if (intrinsicWidth <= WIDTHS[WIDTHS.length - 1]) widths.push(intrinsicWidth);
+  return widths;
+}
+
+/** `partnerships/hubspot/step1.png`, 640, `webp` -> `partnerships/hubspot/step1-640.webp` */
+function variantName(relative, width, format) {
+  return relative.replace(/\.[^.]+$/, `-${width}.${format}`);
+}
+
+/** Paths of every variant `srcSets` looks for, generated or not */
+function variantFiles(sourcePath, intrinsicWidth) {
+  const relative = path.relative(SOURCE_DIR, sourcePath).split(path.sep).join('/');
+  if (relative.startsWith('..')) return [];
+  return FORMATS.flatMap((format) =>
+    targetWidths(intrinsicWidth).map((width) => path.join(OUTPUT_DIR, variantName(relative, width, format))),
+  );
+}
+
+/**
+ * `srcSet` strings per format for the variants generated from `sourcePath`,
+ * or `undefined` if none have been generated yet.
+ */
+function srcSets(sourcePath, intrinsicWidth, baseUrl = '/') {
+  const relative = path.relative(SOURCE_DIR, sourcePath).split(path.sep).join('/');
+  if (relative.startsWith('..')) return undefined;
+  const sets = {};
+  for (const format of FORMATS) {
+    const entries = targetWidths(intrinsicWidth)
+      .filter((width) => fs.existsSync(path.join(OUTPUT_DIR, variantName(relative, width, format))))
+      .map((width) => {
+        const url = encodeURI(`${baseUrl.replace(/\/$/, '')}${OUTPUT_URL}/${variantName(relative, width, format)}`);
+        return `${url} ${width}w`;
+      });
+    if (entries.length === 0) return undefined;
+    sets[format] = entries.join(', ');
+  }
+  return sets;
+}
+
+module.exports = {
+  SOURCE_DIR,
+  OUTPUT_DIR,
+  WIDTHS,
+  FORMATS,
+  targetWidths,
+  variantName,
+  variantFiles,
+  srcSets,
+};
@@ -0,0 +1,70 @@
+/**
+ * Docusaurus plugin that compiles the section chunks written by ./remark.js
+ * to `.docusaurus/lazy-endpoints/`.
+ *
+ * The chunks are outside the docs directory, so the docs MDX rule doesn't
+ * take them: this adds a rule for them with the same loader and options
+ * (remark plugins, admonitions, code highlighting), except that a chunk is
+ * a partial, and that its Markdown links resolve from the page it was cut
+ * from.
+ */
+
+const fs = require('fs');
+const path = require('path');
+const {OUT_DIR_NAME} = require('./remark');
+
+const MDX_LOADER = /[\\/]@docusaurus[\\/]mdx-loader[\\/]/;
+
+const withSlash = (dir) => (dir.endsWith(path.sep) ? dir : `${dir}${path.sep}`);
+
+/** The MDX rule of the docs plugin: the one whose `include` holds the docs directory */
+function docsMdxRule(rules, docsDir) {
+  return rules.find(
+    (rule) =>
+      rule &&
+      Array.isArray(rule.use) &&
+      rule.use.some((item) => MDX_LOADER.test(item.loader || '')) &&
+      [].concat(rule.include || []).some((dir) => typeof dir === 'string' && withSlash(dir) === withSlash(docsDir)),
+  );
+}
+
+module.exports = function lazyEndpointsPlugin(context) {
+  const {siteDir, generatedFilesDir} = context;
+  const docsDir = path.join(siteDir, 'docs');
+  const outDir = path.join(generatedFilesDir, OUT_DIR_NAME);
+
+  /** docs/guidelines/inventory-api.mdx for .docusaurus/lazy-endpoints/guidelines/inventory-api/<section>.mdx */
+  function pageOf(chunkPath) {
+    const pageDir = path.relative(outDir, path.dirname(chunkPath));
+    return (
+      ['.mdx', '.md'].map((ext) => path.join(docsDir, `${pageDir}${ext}`)).find((page) => fs.existsSync(page)) ||
+      chunkPath
+    );
+  }
+
+  return {
+    name: 'lazy-endpoints',
+
+    configureWebpack(config) {
+      const rule = docsMdxRule(config.module.rules, docsDir);
+      if (!rule) {
+        throw new Error('lazy-endpoints: the docs MDX rule was not found; add this plugin after the classic preset.');
+      }
+      const use = rule.use.map((item) => {
+        if (!MDX_LOADER.test(item.loader || '')) return item;
+        const {resolveMarkdownLink} = item.options;
+        return {
+          ...item,
+          options: {
+            ...item.options,
+            isMDXPartial: () => true,
+            resolveMarkdownLink:
+              resolveMarkdownLink &&
+              ((params) => resolveMarkdownLink({...params, sourceFilePath: pageOf(params.sourceFilePath)})),
+          },
+        };
+      });
+      return {module: {rules: [{test: /\.mdx?$/i, include: [withSlash(outDir)], use}]}};
+    },
+  };
+};
@@ -0,0 +1,241 @@
+/**
+ * Remark plugin that moves the body of each large `###` section of a doc into
+ * its own MDX chunk, loaded on demand by `<LazyEndpoint>`.
+ *
+ * Opt in per page with front matter:
+ *
+ *   ---
+ *   lazy_endpoints: true
+ *   ---
+ *
+ * The heading (and the section's leading `<CopyUrl>` badge) stay in the page,
+ * so the overview, the sidebar anchors and `#deep-links` keep working; the
+ * rest of the section is written to `.docusaurus/lazy-endpoints/` (compiled
+ * by the rule of ./index.js) and replaced with a dynamic `import()` that
+ * webpack emits as a separate chunk. The server bundle renders the chunk in
+ * place, so the static HTML still holds the whole section.
+ *
+ * A chunk is compiled as its own module, with its own heading slugger: its
+ * headings are written with the `{#id}` they have in the page, so repeated
+ * headings keep their `-1`, `-2` suffixes and match the TOC. It also gets
+ * the page's `import`s and `export`s.
+ *
+ * Each page's chunks are rewritten when the page is compiled, and the ones
+ * it no longer produces (renamed or removed sections, pages that opted out)
+ * are deleted.
+ */
+
+const path = require('path');
+const {createSlugger} = require('@docusaurus/utils');
+const {
+  DEFAULT_GENERATED_FILES_DIR,
+  DEFAULT_DOCS_DIR,
+  isOptedIn,
+  pageDirOf,
+  writeIfChanged,
+  removeStale,
+  expressionAttribute,
+} = require('../lib/generated-files');
+
+const OUT_DIR_NAME = 'lazy-endpoints';
+const DEFAULT_MIN_CHUNK_SIZE = 2000;
+const FRONT_MATTER_KEY = 'lazy_endpoints';
+
+function textOf(node) {
+  if (node.type === 'text' || node.type === 'inlineCode') return node.value;
+  return (node.children || []).map(textOf).join('');
+}
+
+/**
+ * Heading node -> id, for every heading of the page in document order. The
+ * ids the Docusaurus headings plugin already set are kept; the slugger
+ * still counts them, as that plugin does.
+ */
+function headingIds(tree) {
+  const slugger = createSlugger();
+  const ids = new Map();
+  (function visit(node) {
+    if (node.type === 'heading') {
+      const data = node.data || {};
+      const id = (data.hProperties && data.hProperties.id) || data.id;
+      if (id) {
+        slugger.slug(id, {maintainCase: true});
+        ids.set(node, id);
+      } else {
+        ids.set(node, slugger.slug(textOf(node)));
+      }
+    }
+    (node.children || []).forEach(visit);
+  })(tree);
+  return ids;
+}
+
+function headingsIn(nodes) {
+  return nodes.flatMap((node) => (node.type === 'heading' ? [node] : headingsIn(node.children || [])));
+}
+
+function sourceOf(file, node) {
+  return String(file.value).slice(node.position.start.offset, node.position.end.offset);
+}
+
+/** Page imports and exports, with relative sources made absolute so chunks can reuse them */
+function collectEsm(tree, file) {
+  const dir = path.dirname(file.path);
+  return tree.children
+    .filter((node) => node.type === 'mdxjsEsm')
+    .map((node) =>
+      sourceOf(file, node).replace(
+        /(from\s+|import\s+)(['"])(\.{1,2}\/[^'"]+)\2/g,
+        (match, keyword, quote, source) =>
+          `${keyword}${quote}${path.resolve(dir, source).split(path.sep).join('/')}${quote}`,
+      ),
+    );
+}
+
+/** Names bound by `import X from '...mdx'`: sections rendering partials stay inline */
+function partialBindings(tree) {
+  const names = new Set();
+  for (const node of tree.children) {
+    if (node.type !== 'mdxjsEsm') continue;
+    for (const match of node.value.matchAll(/import\s+(\w+)\s+from\s+['"][^'"]+\.mdx?['"]/g)) {
+      names.add(match[1]);
+    }
+  }
+  return names;
+}
+
+/**
+ * Source of `body` with each heading given its page id as `{#id}`, or
+ * undefined when a heading isn't an ATX heading (`### Title`) that can
+ * take one
+ */
+function bodySource(file, body, ids) {
+  const start = body[0].position.start.offset;
+  let source = String(file.value).slice(start, body[body.length - 1].position.end.offset);
+  const insertions = [];
+  for (const heading of headingsIn(body)) {
+    const raw = sourceOf(file, heading);
+    if (!/^#{1,6}(\s|$)/.test(raw)) return undefined;
+    // Before the optional closing `###`
+    const content = raw.replace(/(\s+#+)?\s*$/, '');
+    if (/\{#[^}]*\}$/.test(content)) continue;
+    insertions.push({offset: heading.position.start.offset - start + content.length, id: ids.get(heading)});
+  }
+  for (const {offset, id} of insertions.reverse()) {
+    source = `${source.slice(0, offset)} {#${id}}${source.slice(offset)}`;
+  }
+  return source;
+}
+
+function containsPartial(node, partials) {
+  if (node.type === 'mdxJsxFlowElement' && partials.has(node.name)) return true;
+  return (node.children || []).some((child) => containsPartial(child, partials));
+}
+
+function importAttribute(source) {
+  const raw = JSON.stringify(source);
+  return expressionAttribute('load', `() => import(${raw})`, {
+    type: 'ArrowFunctionExpression',
+    id: null,
+    params: [],
+    async: false,
+    generator: false,
+    expression: true,
+    body: {type: 'ImportExpression', source: {type: 'Literal', value: source, raw}},
+  });
+}
+
+/** `require.resolveWeak(source)`: the chunk's module id, without bundling it into the page */
+function moduleIdAttribute(source) {
+  const raw = JSON.stringify(source);
+  return expressionAttribute('moduleId', `require.resolveWeak(${raw})`, {
+    type: 'CallExpression',
+    optional: false,
+    callee: {
+      type: 'MemberExpression',
+      computed: false,
+      optional: false,
+      object: {type: 'Identifier', name: 'require'},
+      property: {type: 'Identifier', name: 'resolveWeak'},
+    },
+    arguments: [{type: 'Literal', value: source, raw}],
+  });
+}
+
+/** Split root children into `###` sections: [heading index, body start, body end) */
+function findSections(children) {
+  const sections = [];
+  let current = null;
+  children.forEach((node, index) => {
+    if (node.type !== 'heading' || node.depth > 3) return;
+    if (current) {
+      current.end = index;
+      current = null;
+    }
+    if (node.depth === 3) {
+      current = {heading: index, start: index + 1, end: children.length};
+      sections.push(current);
+    }
+  });
+  return sections;
+}
+
+module.exports = function remarkLazyEndpoints(options = {}) {
+  const outDir = path.join(options.generatedFilesDir || DEFAULT_GENERATED_FILES_DIR, OUT_DIR_NAME);
+  const docsDir = options.docsDir || DEFAULT_DOCS_DIR;
+  const minChunkSize = options.minChunkSize || DEFAULT_MIN_CHUNK_SIZE;
+
+  return (tree, file) => {
+    if (!file.path || file.path.startsWith(outDir) || !file.path.startsWith(docsDir)) {
+      return;
+    }
+    const pageDir = pageDirOf(docsDir, file.path);
+    const written = new Set();
+    if (!isOptedIn(file, FRONT_MATTER_KEY)) {
+      removeStale(path.join(outDir, pageDir), written);
+      return;
+    }
+    const esm = collectEsm(tree, file).join('\n');
+    const partials = partialBindings(tree);
+
+    const children = tree.children;
+    const sections = findSections(children);
+    const ids = headingIds(tree);
+    for (const section of sections) section.id = ids.get(children[section.heading]);
+    // Walk backwards so splicing doesn't shift the sections still to visit
+    for (const section of sections.reverse()) {
+      let {start, end} = section;
+      while (start < end && children[start].type === 'mdxJsxFlowElement' && children[start].name === 'CopyUrl') {
+        start += 1;
+      }
+      while (end > start && children[end - 1].type === 'thematicBreak') {
+        end -= 1;
+      }
+      if (start >= end) continue;
+
+      const body = children.slice(start, end);
+      if (body.some((node) => containsPartial(node, partials))) continue;
+      const source = bodySource(file, body, ids);
+      if (!source || source.length < minChunkSize) continue;
+
+      const {id} = section;
+      writeIfChanged(path.join(outDir, pageDir, `${id}.mdx`), `${esm}\n\n${source}\n`);
+      written.add(`${id}.mdx`);
+
+      const chunk = `@generated/${OUT_DIR_NAME}/${pageDir}/${id}.mdx`;
+      children.splice(start, end - start, {
+        type: 'mdxJsxFlowElement',
+        name: 'LazyEndpoint',
+        attributes: [
+          {type: 'mdxJsxAttribute', name: 'section', value: id},
+          importAttribute(chunk),
+          moduleIdAttribute(chunk),
+        ],
+        children: [],
+      });
+    }
+    removeStale(path.join(outDir, pageDir), written);
+  };
+};
+
+module.exports.OUT_DIR_NAME = OUT_DIR_NAME;
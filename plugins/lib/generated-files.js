@@ -0,0 +1,82 @@
+/**
+ * Helpers of the remark plugins that write files derived from a doc page
+ * under Docusaurus' generatedFilesDir (plugins/lazy-endpoints,
+ * plugins/example-payloads): front matter opt-in, one directory per page,
+ * rewrites that leave unchanged files alone and cleanup of the files a
+ * page no longer produces.
+ */
+
+const fs = require('fs');
+const path = require('path');
+
+// Docusaurus' generatedFilesDir, aliased as `@generated`
+const DEFAULT_GENERATED_FILES_DIR = path.resolve('.docusaurus');
+const DEFAULT_DOCS_DIR = path.resolve('docs');
+
+/** Whether the page's front matter sets `key: true` */
+function isOptedIn(file, key) {
+  const frontMatter = file.data && file.data.frontMatter;
+  if (frontMatter) {
+    return frontMatter[key] === true;
+  }
+  // Fallback for loaders that don't expose the parsed front matter
+  const source = fs.readFileSync(file.path, 'utf8');
+  const block = source.match(/^---\r?\n([\s\S]*?)\r?\n---/);
+  return Boolean(block && new RegExp(`^${key}:\\s*true\\s*$`, 'm').test(block[1]));
+}
+
+/** `guidelines/inventory-api` for docs/guidelines/inventory-api.mdx */
+function pageDirOf(docsDir, filePath) {
+  return path
+    .relative(docsDir, filePath)
+    .replace(/\.mdx?$/, '')
+    .split(path.sep)
+    .join('/');
+}
+
+function writeIfChanged(filePath, content) {
+  if (fs.existsSync(filePath) && fs.readFileSync(filePath, 'utf8') === content) {
+    return;
+  }
+  fs.mkdirSync(path.dirname(filePath), {recursive: true});
+  fs.writeFileSync(filePath, content);
+}
+
+/** Removes the files of a page's directory that the last compilation didn't write */
+function removeStale(dir, written) {
+  if (!fs.existsSync(dir)) return;
+  for (const name of fs.readdirSync(dir)) {
+    if (!written.has(name)) fs.rmSync(path.join(dir, name), {recursive: true, force: true});
+  }
+  if (written.size === 0) fs.rmSync(dir, {recursive: true, force: true});
+}
+
+/** `name={value}`, with `expression` the estree of `value` */
+function expressionAttribute(name, value, expression) {
+  return {
+    type: 'mdxJsxAttribute',
+    name,
+    value: {
+      type: 'mdxJsxAttributeValueExpression',
+      value,
+      data: {
+        estree: {
+          type: 'Program',
+          sourceType: 'module',
+          comments: [],
+          body: [{type: 'ExpressionStatement', expression}],
+        },
+      },
+    },
+  };
+}
+
+module.exports = {
+  DEFAULT_GENERATED_FILES_DIR,
+  DEFAULT_DOCS_DIR,
+  isOptedIn,
+  pageDirOf,
+  writeIfChanged,
+  removeStale,
+  expressionAttribute,
+};
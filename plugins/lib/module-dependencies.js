@@ -0,0 +1,29 @@
+/**
+ * Files the remark plugins read while compiling a page (OpenAPI specs,
+ * screenshots and their variants), which webpack doesn't see as
+ * dependencies of the page's module. plugins/webpack-cache/loader reports
+ * them to webpack, so a change to one of them rebuilds (and invalidates in
+ * the persistent cache) only the pages that read it.
+ *
+ * Each plugin replaces its own list on every compilation of a page. The
+ * lists outlive a compilation: with `mdxCrossCompilerCache` the remark
+ * plugins run once for both the client and the server compilation.
+ */
+
+// Page path -> plugin name -> files
+const dependencies = new Map();
+
+/** Records `files` as what `plugin` read for the page of `file` (a vfile) */
+function setDependencies(file, plugin, files) {
+  if (!file.path) return;
+  if (!dependencies.has(file.path)) dependencies.set(file.path, new Map());
+  dependencies.get(file.path).set(plugin, new Set(files));
+}
+
+/** Every file the remark plugins read for the page at `resourcePath` */
+function dependenciesOf(resourcePath) {
+  const byPlugin = dependencies.get(resourcePath);
+  return byPlugin ? [...new Set([...byPlugin.values()].flatMap((files) => [...files]))] : [];
+}
+
+module.exports = {setDependencies, dependenciesOf};
@@ -0,0 +1,135 @@
+/**
+ * Docusaurus plugin that writes the service worker for offline reading
+ * (`sw.js`, from `./sw.js`) after each build. Readers opt in on the Offline
+ * Access page; see src/clientModules/serviceWorker.
+ *
+ * The worker precaches:
+ * - the home page and every `guidelines/*` route, with the scripts and
+ *   stylesheets they load, and the chunks they only import on demand: the
+ *   `<LazyEndpoint>` sections (plugins/lazy-endpoints), read from the
+ *   client compilation's chunk groups
+ * - the local search: its worker, `search/manifest.json` and the shards it
+ *   lists (plugins/search, registered before this plugin so its postBuild
+ *   has written them)
+ * - the fonts declared in plugins/fonts (WOFF2 subsets when generated)
+ * - the OpenAPI specifications in `openapi/*.json`
+ *
+ * Each entry carries the hash of its content and the worker's version is
+ * the hash of the whole list, so a deploy installs a new worker that only
+ * downloads the entries whose content changed.
+ */
+
+const crypto = require('crypto');
+const fs = require('fs');
+const path = require('path');
+const {FONTS, subsetPath} = require('../fonts');
+
+const PRECACHED_ROUTES = /^(|guidelines(\/.*)?)$/;
+// Requests of the dynamic imports whose chunks are precached
+const ON_DEMAND_CHUNKS = [/^@generated\/lazy-endpoints\/guidelines\//, /search\.worker/];
+const HASH_LENGTH = 10;
+
+const hashOf = (buffer) => crypto.createHash('sha256').update(buffer).digest('hex').slice(0, HASH_LENGTH);
+
+/** Scripts and stylesheets an HTML page loads up front */
+function pageAssets(html) {
+  const assets = new Set();
+  for (const [, attributes] of html.matchAll(/<(?:script|link)\b([^>]*)>/gi)) {
+    const src = attributes.match(/\s(?:src|href)="([^"]+)"/);
+    const rel = attributes.match(/\srel="([^"]+)"/);
+    if (!src || !/\.(js|css)$/.test(src[1])) continue;
+    if (rel && !/\b(stylesheet|preload|modulepreload)\b/.test(rel[1])) continue;
+    assets.add(src[1]);
+  }
+  return assets;
+}
+
+/**
+ * Collects the files of the client chunk groups loaded by `ON_DEMAND_CHUNKS`
+ * imports into `files`, once the compilation is done
+ */
+class OnDemandChunksPlugin {
+  constructor(files) {
+    this.files = files;
+  }
+
+  apply(compiler) {
+    compiler.hooks.done.tap('OnDemandChunksPlugin', ({compilation}) => {
+      this.files.clear();
+      for (const group of compilation.chunkGroups) {
+        const requested = group.origins.some(
+          ({request}) => request && ON_DEMAND_CHUNKS.some((pattern) => pattern.test(request)),
+        );
+        if (!requested) continue;
+        for (const file of group.getFiles()) this.files.add(file);
+      }
+    });
+  }
+}
+
+function searchFiles(outDir, baseUrl) {
+  const manifest = path.join(outDir, 'search/manifest.json');
+  if (!fs.existsSync(manifest)) return [];
+  const {shards} = JSON.parse(fs.readFileSync(manifest, 'utf8'));
+  return ['search/manifest.json', ...shards.map(({url}) => url.slice(baseUrl.length))];
+}
+
+function precacheList(outDir, baseUrl, onDemand) {
+  const files = new Set();
+  const pages = fs
+    .readdirSync(outDir, {recursive: true})
+    .map((name) => name.split(path.sep).join('/'))
+    .filter((name) => name.endsWith('index.html') && PRECACHED_ROUTES.test(path.posix.dirname(name).replace(/^\.$/, '')));
+  for (const page of pages) {
+    files.add(page);
+    for (const url of pageAssets(fs.readFileSync(path.join(outDir, page), 'utf8'))) {
+      if (url.startsWith(baseUrl)) files.add(url.slice(baseUrl.length));
+    }
+  }
+  for (const file of onDemand) files.add(file);
+  for (const file of searchFiles(outDir, baseUrl)) files.add(file);
+  for (const {file} of FONTS) {
+    const subset = `fonts/${subsetPath(file)}`;
+    files.add(fs.existsSync(path.join(outDir, subset)) ? subset : `fonts/${file}.otf`);
+  }
+  for (const name of fs.readdirSync(path.join(outDir, 'openapi'))) {
+    // Content-hashed copies (plugins/openapi/artifacts) duplicate the originals
+    if (/^[^.]+\.json$/.test(name)) files.add(`openapi/${name}`);
+  }
+  if (fs.existsSync(path.join(outDir, '404.html'))) files.add('404.html');
+
+  return [...files]
+    .filter((file) => fs.existsSync(path.join(outDir, file)))
+    .sort()
+    .map((file) => ({
+      // Pages are requested by their route
+      url: `${baseUrl}${file.replace(/(^|\/)index\.html$/, '$1')}`,
+      hash: hashOf(fs.readFileSync(path.join(outDir, file))),
+    }));
+}
+
+module.exports = function offlinePlugin(context) {
+  const {baseUrl} = context.siteConfig;
+  // Output files (relative to outDir) of the on-demand chunks
+  const onDemand = new Set();
+
+  return {
+    name: 'offline',
+
+    configureWebpack(config, isServer) {
+      if (isServer) return {};
+      return {plugins: [new OnDemandChunksPlugin(onDemand)]};
+    },
+
+    async postBuild({outDir}) {
+      const precache = precacheList(outDir, baseUrl, onDemand);
+      const version = hashOf(JSON.stringify(precache));
+      const worker = fs
+        .readFileSync(path.join(__dirname, 'sw.js'), 'utf8')
+        .replace('self.__PRECACHE__', () => JSON.stringify(precache))
+        .replace('self.__VERSION__', () => JSON.stringify(version))
+        .replace('self.__BASE_URL__', () => JSON.stringify(baseUrl));
+      fs.writeFileSync(path.join(outDir, 'sw.js'), worker);
+    },
+  };
+};
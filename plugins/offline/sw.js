@@ -0,0 +1,99 @@
+/* Template for the service worker written by plugins/offline */
+
+const PRECACHE = self.__PRECACHE__;
+const VERSION = self.__VERSION__;
+const BASE_URL = self.__BASE_URL__;
+
+const CACHE_PREFIX = 'iqm-docs-';
+const CACHE_NAME = `${CACHE_PREFIX}${VERSION}`;
+// Entry hashes of the cache, to reuse unchanged entries in the next version
+const MANIFEST_URL = `${BASE_URL}__precache-manifest`;
+// Content-hashed build output never changes
+const IMMUTABLE = new RegExp(`^${BASE_URL}assets/`);
+
+async function previousCache() {
+  const names = (await caches.keys()).filter((name) => name.startsWith(CACHE_PREFIX) && name !== CACHE_NAME);
+  for (const name of names.reverse()) {
+    const cache = await caches.open(name);
+    const manifest = await cache.match(MANIFEST_URL);
+    if (manifest) return {cache, hashes: new Map((await manifest.json()).map(({url, hash}) => [url, hash]))};
+  }
+  return null;
+}
+
+self.addEventListener('install', (event) => {
+  event.waitUntil(
+    (async () => {
+      const cache = await caches.open(CACHE_NAME);
+      const previous = await previousCache();
+      await Promise.all(
+        PRECACHE.map(async ({url, hash}) => {
+          const reusable = previous && previous.hashes.get(url) === hash && (await previous.cache.match(url));
+          if (reusable) return cache.put(url, reusable);
+          const response = await fetch(url, {cache: 'no-cache'});
+          if (!response.ok) throw new Error(`${url}: ${response.status}`);
+          return cache.put(url, response);
+        }),
+      );
+      await cache.put(MANIFEST_URL, new Response(JSON.stringify(PRECACHE)));
+      await self.skipWaiting();
+    })(),
+  );
+});
+
+self.addEventListener('activate', (event) => {
+  event.waitUntil(
+    (async () => {
+      for (const name of await caches.keys()) {
+        if (name.startsWith(CACHE_PREFIX) && name !== CACHE_NAME) await caches.delete(name);
+      }
+      await self.clients.claim();
+    })(),
+  );
+});
+
+/** Cached response right away, refreshed in the background; network when not cached */
+async function staleWhileRevalidate(event, cacheKey) {
+  const cache = await caches.open(CACHE_NAME);
+  const cached = await cache.match(cacheKey);
+  const refresh = fetch(event.request).then(async (response) => {
+    if (response.ok) await cache.put(cacheKey, response.clone());
+    return response;
+  });
+  if (cached) {
+    event.waitUntil(refresh.catch(() => undefined));
+    return cached;
+  }
+  try {
+    return await refresh;
+  } catch (error) {
+    if (event.request.mode === 'navigate') {
+      const notFound = await cache.match(`${BASE_URL}404.html`);
+      if (notFound) return notFound;
+    }
+    throw error;
+  }
+}
+
+async function cacheFirst(event) {
+  const cache = await caches.open(CACHE_NAME);
+  const cached = await cache.match(event.request);
+  if (cached) return cached;
+  const response = await fetch(event.request);
+  if (response.ok) await cache.put(event.request, response.clone());
+  return response;
+}
+
+self.addEventListener('fetch', (event) => {
+  const url = new URL(event.request.url);
+  if (event.request.method !== 'GET' || url.origin !== self.location.origin || !url.pathname.startsWith(BASE_URL)) {
+    return;
+  }
+  if (IMMUTABLE.test(url.pathname)) {
+    event.respondWith(cacheFirst(event));
+    return;
+  }
+  // Pages are cached by route, whatever the query or hash
+  const cacheKey = event.request.mode === 'navigate' ? url.pathname : event.request;
+  event.respondWith(staleWhileRevalidate(event, cacheKey));
+});
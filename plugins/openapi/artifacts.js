@@ -0,0 +1,170 @@
+/**
+ * Docusaurus plugin that publishes the OpenAPI specifications in
+ * `static/openapi` in cache-friendly form after each build:
+ *
+ * - `openapi.json` split per tag into `openapi/tags/<tag>.<hash>.json`
+ * - a content-hashed copy of every specification (`mcp-user.<hash>.json`),
+ *   safe to cache forever
+ * - pre-compressed `.br` and `.gz` siblings of all of the above and of the
+ *   unhashed originals
+ * - `mcp-manifest.json` extended with an `artifacts` list carrying the
+ *   URL, SHA-256 and byte sizes of each file, so tooling can fetch only the
+ *   APIs it needs and skip files whose hash it already has
+ *
+ * Every operation of the published specifications carries its resolved
+ * `x-operational-limits` (rate limit, page sizes, batch size, ...; see
+ * `operationalLimits` in ./lib/spec), so clients can size their
+ * concurrency from the spec alone. Per-API specs take the defaults and
+ * per-operation values of `openapi.json`.
+ *
+ * The original `specifications` list in the manifest is left untouched.
+ */
+
+const crypto = require('crypto');
+const fs = require('fs');
+const path = require('path');
+const zlib = require('zlib');
+const {HTTP_METHODS, WEBHOOKS_EXTENSION, withOperationalLimits} = require('./lib/spec');
+
+const SPEC_DIR = 'openapi';
+const MANIFEST = 'mcp-manifest.json';
+const HASH_LENGTH = 10;
+
+const sha256 = (buffer) => crypto.createHash('sha256').update(buffer).digest('hex');
+
+const slugify = (value) =>
+  value
+    .toLowerCase()
+    .replace(/[^a-z0-9]+/g, '-')
+    .replace(/^-|-$/g, '');
+
+const countOperations = (spec) =>
+  Object.values(spec.paths || {}).reduce(
+    (count, pathItem) => count + HTTP_METHODS.filter((method) => pathItem[method]).length,
+    0,
+  );
+
+/** `{x-webhooks}` holding the webhooks with `tag`, or nothing */
+function tagWebhooks(webhooks = {}, tag) {
+  const tagged = Object.entries(webhooks).filter(([, pathItem]) =>
+    HTTP_METHODS.some((method) => pathItem[method] && (pathItem[method].tags || []).includes(tag)),
+  );
+  return tagged.length ? {[WEBHOOKS_EXTENSION]: Object.fromEntries(tagged)} : {};
+}
+
+/** One spec per tag, each holding only the operations (and webhooks) with that tag */
+function splitByTag(spec) {
+  const specs = new Map();
+  for (const [apiPath, pathItem] of Object.entries(spec.paths || {})) {
+    for (const method of HTTP_METHODS) {
+      const operation = pathItem[method];
+      if (!operation) continue;
+      for (const tag of operation.tags && operation.tags.length ? operation.tags : ['Untagged']) {
+        if (!specs.has(tag)) {
+          const {paths, tags, [WEBHOOKS_EXTENSION]: webhooks, ...rest} = spec;
+          specs.set(tag, {...rest, tags: [{name: tag}], paths: {}, ...tagWebhooks(webhooks, tag)});
+        }
+        const paths = specs.get(tag).paths;
+        if (!paths[apiPath]) {
+          // Path-level fields (parameters, servers, ...) apply to every method
+          paths[apiPath] = Object.fromEntries(
+            Object.entries(pathItem).filter(([key]) => !HTTP_METHODS.includes(key)),
+          );
+        }
+        paths[apiPath][method] = operation;
+      }
+    }
+  }
+  return specs;
+}
+
+function compress(buffer) {
+  return {
+    br: zlib.brotliCompressSync(buffer, {
+      params: {
+        [zlib.constants.BROTLI_PARAM_QUALITY]: zlib.constants.BROTLI_MAX_QUALITY,
+        [zlib.constants.BROTLI_PARAM_SIZE_HINT]: buffer.length,
+      },
+    }),
+    gz: zlib.gzipSync(buffer, {level: zlib.constants.Z_BEST_COMPRESSION}),
+  };
+}
+
+/** Writes `buffer` to `filePath` with its `.br` and `.gz` siblings */
+function writeWithCompressed(filePath, buffer, compressed = compress(buffer)) {
+  fs.mkdirSync(path.dirname(filePath), {recursive: true});
+  fs.writeFileSync(filePath, buffer);
+  fs.writeFileSync(`${filePath}.br`, compressed.br);
+  fs.writeFileSync(`${filePath}.gz`, compressed.gz);
+  return {brotliBytes: compressed.br.length, gzipBytes: compressed.gz.length};
+}
+
+module.exports = function openApiArtifactsPlugin(context) {
+  const {url: siteUrl, baseUrl} = context.siteConfig;
+  const publicUrl = (relative) => `${siteUrl.replace(/\/$/, '')}${baseUrl}${relative}`;
+
+  return {
+    name: 'openapi-artifacts',
+
+    async postBuild({outDir}) {
+      const specDir = path.join(outDir, SPEC_DIR);
+      const manifestPath = path.join(specDir, MANIFEST);
+      if (!fs.existsSync(manifestPath)) return;
+
+      const artifacts = [];
+      /** Writes `buffer` as `<name>.<hash>.json` (+ .br/.gz) and records it */
+      const publish = (relativeDir, name, buffer, compressed, extra) => {
+        const hash = sha256(buffer);
+        const fileName = `${name}.${hash.slice(0, HASH_LENGTH)}.json`;
+        const sizes = writeWithCompressed(path.join(specDir, relativeDir, fileName), buffer, compressed);
+        artifacts.push({
+          name,
+          ...extra,
+          url: publicUrl(path.posix.join(SPEC_DIR, relativeDir, fileName)),
+          sha256: hash,
+          bytes: buffer.length,
+          ...sizes,
+        });
+      };
+
+      const sources = fs
+        .readdirSync(specDir)
+        .filter((file) => file.endsWith('.json') && file !== MANIFEST)
+        .sort();
+
+      const mainSpecPath = path.join(specDir, 'openapi.json');
+      const reference = fs.existsSync(mainSpecPath) ? JSON.parse(fs.readFileSync(mainSpecPath, 'utf8')) : {};
+
+      for (const file of sources) {
+        const filePath = path.join(specDir, file);
+        const text = fs.readFileSync(filePath, 'utf8');
+        const source = JSON.parse(text);
+        const spec = source.paths ? withOperationalLimits(source, reference) : source;
+        // Keeps the formatting of the original (minified or indented)
+        const buffer = Buffer.from(text.startsWith('{\n') ? `${JSON.stringify(spec, null, 2)}\n` : JSON.stringify(spec));
+        const name = path.basename(file, '.json');
+        const compressed = compress(buffer);
+        writeWithCompressed(filePath, buffer, compressed);
+        publish('', name, buffer, compressed, {
+          source: publicUrl(path.posix.join(SPEC_DIR, file)),
+          operations: countOperations(spec),
+        });
+
+        if (name === 'openapi') {
+          for (const [tag, tagSpec] of splitByTag(spec)) {
+            const tagBuffer = Buffer.from(JSON.stringify(tagSpec));
+            publish('tags', slugify(tag), tagBuffer, compress(tagBuffer), {
+              tag,
+              parent: name,
+              operations: countOperations(tagSpec),
+            });
+          }
+        }
+      }
+
+      const manifest = JSON.parse(fs.readFileSync(manifestPath, 'utf8'));
+      const manifestBuffer = Buffer.from(`${JSON.stringify({...manifest, artifacts}, null, 2)}\n`);
+      writeWithCompressed(manifestPath, manifestBuffer);
+    },
+  };
+};
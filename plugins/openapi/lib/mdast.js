@@ -0,0 +1,177 @@
+/**
+ * Small mdast builders for remark plugins that emit the same markup the
+ * guideline pages write by hand (CopyUrl badge, parameter tables,
+ * `objectProperties` tables, titled code blocks).
+ */
+
+const text = (value) => ({type: 'text', value: String(value)});
+const inlineCode = (value) => ({type: 'inlineCode', value: String(value)});
+const paragraph = (children) => ({type: 'paragraph', children});
+const lineBreak = () => ({type: 'break'});
+
+/**
+ * Phrasing nodes of a spec description: `code` spans, [links](url),
+ * **strong** and *emphasis*, `<var>value</var>` and `<br />` are kept,
+ * links to the docs site become site-relative. Anything else is text.
+ */
+function inlineMarkdown(value, siteOrigin = 'https://developers.iqm.com') {
+  const nodes = [];
+  const pattern = new RegExp(
+    [
+      /`(?<code>[^`]+)`/.source,
+      /\[(?<label>[^\]]+)\]\((?<url>[^)\s]+)\)/.source,
+      /\*\*(?!\s)(?<strong>[^*\n]+?)(?<!\s)\*\*/.source,
+      // Not the `*` of `*/*` or of a list
+      /(?<![\w*])\*(?=\w)(?<emphasis>[^*\n]+?)(?<=[\w.)])\*(?![\w*])/.source,
+      /<var>(?<variable>[^<]*)<\/var>/.source,
+      /<br\s*\/?>/.source,
+    ].join('|'),
+    'g',
+  );
+  let last = 0;
+  for (const match of value.matchAll(pattern)) {
+    const {code, label, url, strong, emphasis, variable} = match.groups;
+    if (match.index > last) nodes.push(text(value.slice(last, match.index)));
+    if (code !== undefined) {
+      nodes.push(inlineCode(code));
+    } else if (label !== undefined) {
+      const href = url.startsWith(`${siteOrigin}/`) ? url.slice(siteOrigin.length) : url;
+      nodes.push({type: 'link', url: href, children: [text(label)]});
+    } else if (strong !== undefined) {
+      nodes.push({type: 'strong', children: [text(strong)]});
+    } else if (emphasis !== undefined) {
+      nodes.push({type: 'emphasis', children: [text(emphasis)]});
+    } else if (variable !== undefined) {
+      nodes.push({type: 'mdxJsxTextElement', name: 'var', attributes: [], children: [text(variable)]});
+    } else {
+      nodes.push(lineBreak());
+    }
+    last = match.index + match[0].length;
+  }
+  if (last < value.length) nodes.push(text(value.slice(last)));
+  return nodes;
+}
+
+function toAttributes(attributes) {
+  return Object.entries(attributes)
+    .filter(([, value]) => value !== undefined && value !== null)
+    .map(([name, value]) => ({type: 'mdxJsxAttribute', name, value: String(value)}));
+}
+
+function jsxFlow(name, attributes = {}, children = []) {
+  return {type: 'mdxJsxFlowElement', name, attributes: toAttributes(attributes), children};
+}
+
+function jsxText(name, attributes = {}, children = []) {
+  return {type: 'mdxJsxTextElement', name, attributes: toAttributes(attributes), children};
+}
+
+/** Read string-valued attributes off an MDX JSX node */
+function readAttributes(node) {
+  const attributes = {};
+  for (const attribute of node.attributes || []) {
+    if (attribute.type !== 'mdxJsxAttribute') continue;
+    if (attribute.value === null || attribute.value === undefined) {
+      attributes[attribute.name] = true;
+    } else if (typeof attribute.value === 'string') {
+      attributes[attribute.name] = attribute.value;
+    }
+  }
+  return attributes;
+}
+
+function typeLabel(row) {
+  const children = [inlineCode(row.name), lineBreak(), jsxText('span', {className: 'type-text'}, [text(row.type)])];
+  if (row.required) {
+    children.push(text(' '), jsxText('span', {className: 'required-text'}, [text('required')]));
+  }
+  return children;
+}
+
+function descriptionCell(row) {
+  const children = row.description ? inlineMarkdown(row.description) : [];
+  if (row.enum && row.enum.length > 0) {
+    if (children.length > 0) children.push(lineBreak());
+    children.push(text('Allowed values: '));
+    row.enum.forEach((value, i) => {
+      if (i > 0) children.push(text(', '));
+      children.push(jsxText('var', {}, [text(value)]));
+    });
+  }
+  return children;
+}
+
+/** GFM table in the `| Path Parameters |  |` style */
+function parameterTable(title, rows) {
+  const cell = (children) => ({type: 'tableCell', children});
+  return {
+    type: 'table',
+    align: [null, null],
+    children: [
+      {type: 'tableRow', children: [cell([text(title)]), cell([])]},
+      ...rows.map((row) => ({
+        type: 'tableRow',
+        children: [
+          cell([
+            jsxText('span', {className: 'code-text'}, [text(row.name)]),
+            lineBreak(),
+            jsxText('span', {className: 'type-text'}, [text(row.type)]),
+            ...(row.required
+              ? [text(' '), jsxText('span', {className: 'required-text'}, [text('required')])]
+              : []),
+          ]),
+          cell(descriptionCell(row)),
+        ],
+      })),
+    ],
+  };
+}
+
+/**
+ * `<table className="objectProperties">` wrapped in a collapsible `<details>`.
+ * Cells hold phrasing content directly, as the hand-written tables do.
+ */
+function propertiesDetails(summary, rows) {
+  const tableRows = rows.map((row) =>
+    jsxFlow('tr', {}, [
+      jsxFlow('td', {}, typeLabel(row)),
+      jsxFlow('td', {}, descriptionCell(row)),
+    ]),
+  );
+  return jsxFlow('details', {className: 'objectPropertiesDetails'}, [
+    jsxFlow('summary', {}, [text(summary)]),
+    jsxFlow('table', {className: 'objectProperties'}, [jsxFlow('tbody', {}, tableRows)]),
+  ]);
+}
+
+/** GFM table with a header row; cells are arrays of phrasing nodes */
+function dataTable(headers, rows) {
+  const cell = (children) => ({type: 'tableCell', children});
+  return {
+    type: 'table',
+    align: headers.map(() => null),
+    children: [
+      {type: 'tableRow', children: headers.map((header) => cell([text(header)]))},
+      ...rows.map((row) => ({type: 'tableRow', children: row.map(cell)})),
+    ],
+  };
+}
+
+function codeBlock(lang, title, value) {
+  return {type: 'code', lang, meta: title ? `title="${title}"` : null, value};
+}
+
+module.exports = {
+  text,
+  inlineCode,
+  inlineMarkdown,
+  paragraph,
+  lineBreak,
+  jsxFlow,
+  jsxText,
+  readAttributes,
+  parameterTable,
+  propertiesDetails,
+  dataTable,
+  codeBlock,
+};
@@ -0,0 +1,340 @@
+/**
+ * Code generation for the TypeScript SDK in `sdk/`, shared by
+ * scripts/generate-sdk.js (the modules) and the `<OpenApiSdkSample>`
+ * placeholder of ../remark-endpoint (the docs samples), so both name
+ * modules, functions and parameters the same way.
+ *
+ * Every `mcp-<domain>.json` specification becomes a module
+ * `@iqm/sdk/<domain>` exporting one function per operation.
+ */
+
+const fs = require('fs');
+const path = require('path');
+const {
+  DEFAULT_SPEC_PATH,
+  loadSpec,
+  listOperations,
+  resolveRef,
+  jsonContent,
+  firstExample,
+  sampleFromSchema,
+  successResponse,
+  documentedParameters,
+  operationalLimits,
+  withOperationalLimits,
+} = require('./spec');
+
+const DEFAULT_SPEC_DIR = path.resolve(__dirname, '../../../static/openapi');
+const PACKAGE_NAME = '@iqm/sdk';
+const SPEC_FILE = /^mcp-(?!manifest)([\w-]+)\.json$/;
+const MAX_INLINE_DEPTH = 6;
+
+const IDENTIFIER = /^[A-Za-z_$][\w$]*$/;
+
+function camelCase(value) {
+  const words = String(value)
+    .replace(/([a-z0-9])([A-Z])/g, '$1 $2')
+    .split(/[^A-Za-z0-9]+/)
+    .filter(Boolean);
+  const name = words
+    .map((word, index) => {
+      const lower = word.toLowerCase();
+      return index === 0 ? lower : lower[0].toUpperCase() + lower.slice(1);
+    })
+    .join('');
+  return /^\d/.test(name) ? `_${name}` : name || 'operation';
+}
+
+const pascalCase = (value) => {
+  const name = camelCase(value);
+  return name[0] === '_' ? name : name[0].toUpperCase() + name.slice(1);
+};
+
+const propertyKey = (name) => (IDENTIFIER.test(name) ? name : JSON.stringify(name));
+
+/** Operations of one specification with the function and type names they get */
+function moduleOperations(spec) {
+  const used = new Set();
+  const typeNames = new Set(Object.keys((spec.components && spec.components.schemas) || {}).map(schemaTypeName));
+  // Operation types that would shadow a component schema get an `Operation` infix
+  const operationType = (base, suffix) => {
+    const name = typeNames.has(`${base}${suffix}`) ? `${base}Operation${suffix}` : `${base}${suffix}`;
+    typeNames.add(name);
+    return name;
+  };
+  return listOperations(spec).map((operation) => {
+    const base = camelCase(operation.operationId || `${operation.method} ${operation.path}`);
+    let name = base;
+    for (let index = 2; used.has(name); index += 1) name = `${base}${index}`;
+    used.add(name);
+    const typeName = pascalCase(name);
+    return {
+      ...operation,
+      name,
+      paramsTypeName: operationType(typeName, 'Params'),
+      responseTypeName: operationType(typeName, 'Response'),
+    };
+  });
+}
+
+const modulesCache = new WeakMap();
+
+/**
+ * `domain -> {file, spec, operations}` for every mcp-*.json in `specDir`,
+ * each spec carrying the operational limits resolved against openapi.json
+ * (as published by ../artifacts)
+ */
+function loadModules(specDir = DEFAULT_SPEC_DIR) {
+  const reference = loadSpec(path.join(specDir, path.basename(DEFAULT_SPEC_PATH)));
+  const modules = new Map();
+  for (const file of fs.readdirSync(specDir).sort()) {
+    const match = file.match(SPEC_FILE);
+    if (!match) continue;
+    const source = loadSpec(path.join(specDir, file));
+    if (!modulesCache.has(source)) {
+      const spec = withOperationalLimits(source, reference);
+      modulesCache.set(source, {file, spec, operations: moduleOperations(spec)});
+    }
+    modules.set(match[1], modulesCache.get(source));
+  }
+  return modules;
+}
+
+/** Module and operation documenting `METHOD path`, or undefined */
+function findSdkOperation(modules, method, apiPath) {
+  const key = `${method.toUpperCase()} ${apiPath}`;
+  for (const [domain, module] of modules) {
+    const operation = module.operations.find((candidate) => candidate.key === key);
+    if (operation) return {domain, module, operation};
+  }
+  return undefined;
+}
+
+// Types
+
+const schemaTypeName = (ref) => pascalCase(ref.split('/').pop());
+
+function indent(text, depth) {
+  return text.replace(/\n/g, `\n${'  '.repeat(depth)}`);
+}
+
+/**
+ * TypeScript type of a schema; component schemas are referenced by name,
+ * or with `inline` (for the samples, which don't import them) expanded
+ */
+function tsType(spec, schema, depth = 0, inline = false) {
+  if (!schema) return 'unknown';
+  if (schema.$ref) {
+    if (!inline && schema.$ref.startsWith('#/components/schemas/')) return schemaTypeName(schema.$ref);
+    return depth > MAX_INLINE_DEPTH ? 'unknown' : tsType(spec, resolveRef(spec, schema), depth + 1, inline);
+  }
+  const nullable = schema.nullable ? ' | null' : '';
+  if (schema.allOf) return `${schema.allOf.map((member) => tsType(spec, member, depth, inline)).join(' & ')}${nullable}`;
+  const union = schema.oneOf || schema.anyOf;
+  if (union) return `${union.map((member) => tsType(spec, member, depth, inline)).join(' | ')}${nullable}`;
+  if (schema.enum) return `${schema.enum.map((value) => JSON.stringify(value)).join(' | ')}${nullable}`;
+
+  switch (schema.type) {
+    case 'integer':
+    case 'number':
+      return `number${nullable}`;
+    case 'boolean':
+      return `boolean${nullable}`;
+    case 'string':
+      return `${schema.format === 'binary' ? 'Blob' : 'string'}${nullable}`;
+    case 'array': {
+      const items = tsType(spec, schema.items, depth + 1, inline);
+      return `${/[|&\s]/.test(items) && !items.startsWith('{') ? `Array<${items}>` : `${items}[]`}${nullable}`;
+    }
+    default: {
+      if (!schema.properties && !schema.additionalProperties) {
+        return schema.type === 'object' ? `Record<string, unknown>${nullable}` : 'unknown';
+      }
+      if (depth > MAX_INLINE_DEPTH) return 'Record<string, unknown>';
+      return `${objectType(spec, schema, depth, inline)}${nullable}`;
+    }
+  }
+}
+
+function objectType(spec, schema, depth, inline) {
+  const required = new Set(schema.required || []);
+  const members = Object.entries(schema.properties || {}).map(([name, property]) => {
+    const docs = property.description ? `/** ${property.description.split('\n')[0].replace(/\*\//g, '* /')} */\n` : '';
+    return `${docs}${propertyKey(name)}${required.has(name) ? '' : '?'}: ${tsType(spec, property, depth + 1, inline)};`;
+  });
+  if (schema.additionalProperties) {
+    const value =
+      schema.additionalProperties === true ? 'unknown' : tsType(spec, schema.additionalProperties, depth + 1, inline);
+    members.push(`[key: string]: ${value};`);
+  }
+  return members.length ? `{\n  ${indent(members.join('\n'), 1)}\n}` : 'Record<string, never>';
+}
+
+function parameterGroup(spec, parameters, location) {
+  const params = parameters.filter((param) => param.in === location);
+  if (!params.length) return undefined;
+  const members = params.map((param) => {
+    const docs = param.description ? `/** ${param.description.split('\n')[0].replace(/\*\//g, '* /')} */\n` : '';
+    return `${docs}${propertyKey(param.name)}${param.required ? '' : '?'}: ${tsType(spec, param.schema || {type: 'string'})};`;
+  });
+  return {required: params.some((param) => param.required), type: `{\n  ${indent(members.join('\n'), 1)}\n}`};
+}
+
+function requestBodyType(spec, operation) {
+  const {requestBody} = operation.operation;
+  if (!requestBody) return undefined;
+  const content = requestBody.content || {};
+  if (Object.keys(content).some((type) => /multipart|form-data/i.test(type))) {
+    return {required: Boolean(requestBody.required), type: 'FormData'};
+  }
+  const media = jsonContent(content);
+  return {required: Boolean(requestBody.required), type: media && media.schema ? tsType(spec, media.schema) : 'unknown'};
+}
+
+function responseType(spec, operation, inline = false) {
+  const success = successResponse(operation.operation);
+  const media = success && jsonContent(success.response.content);
+  return media && media.schema ? tsType(spec, media.schema, 0, inline) : 'unknown';
+}
+
+/** Pagination and batching metadata the runtime reads off each operation */
+function operationMetadata(spec, operation) {
+  const limits = operationalLimits(spec, operation);
+  return {
+    method: operation.method,
+    path: operation.path,
+    ...(limits.pageSizeParam && {
+      pagination: {
+        style: limits.pagination || 'pageNo',
+        sizeParam: limits.pageSizeParam,
+        in: limits.pageParamsIn || 'query',
+        ...(limits.maxPageSize && {maxPageSize: limits.maxPageSize}),
+      },
+    }),
+    ...(limits.batchSize && {batchSize: limits.batchSize}),
+    ...(limits.rateLimit && {rateLimit: limits.rateLimit}),
+  };
+}
+
+const docComment = (operation) => {
+  const lines = [operation.summary || `${operation.method} ${operation.path}`, '', `\`${operation.method} ${operation.path}\``];
+  return `/**\n${lines.map((line) => ` *${line ? ` ${line.replace(/\*\//g, '* /')}` : ''}`).join('\n')}\n */`;
+};
+
+/** `{js, dts}` source of the module generated for `spec` */
+function generateModule(spec, operations) {
+  const js = [
+    '// Generated by scripts/generate-sdk.js; do not edit.',
+    `import {defineOperation} from '../client.js';`,
+    '',
+  ];
+  const dts = [
+    '// Generated by scripts/generate-sdk.js; do not edit.',
+    `import type {Operation} from '../client.js';`,
+    '',
+  ];
+
+  for (const [name, schema] of Object.entries((spec.components && spec.components.schemas) || {})) {
+    dts.push(`export type ${schemaTypeName(name)} = ${tsType(spec, schema)};`, '');
+  }
+
+  for (const operation of operations) {
+    const parameters = documentedParameters(spec, operation.parameters);
+    const groups = [
+      ['path', parameterGroup(spec, parameters, 'path')],
+      ['query', parameterGroup(spec, parameters, 'query')],
+      ['body', requestBodyType(spec, operation)],
+    ].filter(([, group]) => group);
+    const paramsType = groups.length
+      ? `{\n  ${indent(groups.map(([key, group]) => `${key}${group.required ? '' : '?'}: ${group.type};`).join('\n'), 1)}\n}`
+      : 'Record<string, never>';
+    const metadata = operationMetadata(spec, operation);
+
+    js.push(docComment(operation));
+    js.push(`export const ${operation.name} = /*#__PURE__*/ defineOperation(${JSON.stringify(metadata)});`, '');
+
+    const {paramsTypeName: paramsName, responseTypeName: responseName} = operation;
+    dts.push(`export type ${paramsName} = ${paramsType};`, '');
+    dts.push(`export type ${responseName} = ${responseType(spec, operation)};`, '');
+    dts.push(docComment(operation));
+    dts.push(`export declare const ${operation.name}: Operation<${paramsName}, ${responseName}>;`, '');
+  }
+  return {js: js.join('\n'), dts: dts.join('\n')};
+}
+
+// Samples
+
+function exampleOf(spec, param) {
+  const schema = resolveRef(spec, param.schema || {});
+  if (param.example !== undefined) return param.example;
+  if (schema.example !== undefined) return schema.example;
+  if (schema.default !== undefined) return schema.default;
+  return sampleFromSchema(spec, schema);
+}
+
+const literal = (value, depth) => indent(JSON.stringify(value, null, 2), depth).replace(/"([A-Za-z_$][\w$]*)":/g, '$1:');
+
+/** TypeScript sample calling `operation` through the SDK, typed with its response spelled out */
+function sdkSample(domain, spec, operation) {
+  const {pagination} = operationMetadata(spec, operation);
+  const paging = pagination ? new Set(['pageNo', 'offset', pagination.sizeParam]) : new Set();
+  const parameters = documentedParameters(spec, operation.parameters);
+
+  const groups = [];
+  for (const location of ['path', 'query']) {
+    const values = {};
+    for (const param of parameters.filter((entry) => entry.in === location)) {
+      if (paging.has(param.name) || (location === 'query' && !param.required)) continue;
+      values[param.name] = exampleOf(spec, param);
+    }
+    if (Object.keys(values).length) groups.push(`${location}: ${literal(values, 1)}`);
+  }
+  const body = requestBodyType(spec, operation);
+  if (body && body.type === 'FormData') {
+    groups.push('body: formData');
+  } else if (body) {
+    const media = jsonContent(operation.operation.requestBody.content);
+    let value = firstExample(media);
+    if (value === undefined && media && media.schema) value = sampleFromSchema(spec, media.schema);
+    if (value && typeof value === 'object' && !Array.isArray(value)) {
+      value = Object.fromEntries(Object.entries(value).filter(([key]) => !paging.has(key)));
+    }
+    if (value !== undefined) groups.push(`body: ${literal(value, 1)}`);
+  }
+  const params = groups.length ? `{\n  ${groups.join(',\n  ')},\n}` : '';
+
+  // `client` is the shared client of the "TypeScript Prerequisites" page
+  const {responseTypeName} = operation;
+  const lines = [
+    ...(pagination ? [`import {paginate, type PageItem} from '${PACKAGE_NAME}';`] : []),
+    `import {${operation.name}} from '${PACKAGE_NAME}/${domain}';`,
+    `import {client} from './client';`,
+    '',
+    // Spelled out for the reader; the module exports it under the same name
+    `/** Response of \`${operation.method} ${operation.path}\` */`,
+    `type ${responseTypeName} = ${responseType(spec, operation, true)};`,
+    '',
+  ];
+  if (pagination) {
+    lines.push(
+      '// Requests the next page while the items of this one are processed',
+      `const items: AsyncIterable<PageItem<${responseTypeName}>> = paginate(client, ${operation.name}${params ? `, ${params}` : ''});`,
+      'for await (const item of items) {',
+      '  console.log(item);',
+      '}',
+    );
+  } else {
+    lines.push(`const response: ${responseTypeName} = await ${operation.name}(client${params ? `, ${params}` : ''});`);
+  }
+  return lines.join('\n');
+}
+
+module.exports = {
+  DEFAULT_SPEC_DIR,
+  PACKAGE_NAME,
+  camelCase,
+  loadModules,
+  findSdkOperation,
+  generateModule,
+  sdkSample,
+};
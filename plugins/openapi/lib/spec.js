@@ -0,0 +1,355 @@
+/**
+ * Helpers for reading the IQM OpenAPI specification at build time.
+ *
+ * Everything here runs in Node (remark plugins, Docusaurus plugins and
+ * scripts) and never ships to the browser.
+ */
+
+const fs = require('fs');
+const path = require('path');
+
+const DEFAULT_SPEC_PATH = path.resolve(__dirname, '../../../static/openapi/openapi.json');
+const DEFAULT_API_ORIGIN = 'https://api.iqm.com';
+const HTTP_METHODS = ['get', 'post', 'put', 'patch', 'delete'];
+
+// Operational limits extension: on the spec root (all operations), on a
+// root `tags` entry (that tag's operations) and on operations
+const LIMITS_EXTENSION = 'x-operational-limits';
+// Webhooks: `webhooks` in OpenAPI 3.1, this extension in our 3.0 spec
+const WEBHOOKS_EXTENSION = 'x-webhooks';
+const PAGE_SIZE_PARAMS = ['noOfEntries', 'limit', 'pageSize'];
+
+// Headers already documented once per page in the "Authentication" table
+const AUTH_HEADER_PATTERN = /^(authori[sz]ation|authentication|x-iaa-ow-id|\{\{ow_id_header_key\}\})$/i;
+
+const cache = new Map();
+const operationsCache = new WeakMap();
+
+function loadSpec(specPath = DEFAULT_SPEC_PATH) {
+  const {mtimeMs} = fs.statSync(specPath);
+  const cached = cache.get(specPath);
+  if (cached && cached.mtimeMs === mtimeMs) {
+    return cached.spec;
+  }
+  const spec = JSON.parse(fs.readFileSync(specPath, 'utf8'));
+  cache.set(specPath, {mtimeMs, spec});
+  return spec;
+}
+
+function operationKey(method, apiPath) {
+  return `${method.toUpperCase()} ${apiPath}`;
+}
+
+/** Flat list of every operation in the spec, in document order */
+function listOperations(spec) {
+  if (operationsCache.has(spec)) {
+    return operationsCache.get(spec);
+  }
+  const operations = [];
+  for (const [apiPath, pathItem] of Object.entries(spec.paths || {})) {
+    for (const method of HTTP_METHODS) {
+      const operation = pathItem[method];
+      if (!operation) continue;
+      operations.push({
+        key: operationKey(method, apiPath),
+        method: method.toUpperCase(),
+        path: apiPath,
+        operationId: operation.operationId,
+        tags: operation.tags || [],
+        summary: operation.summary || '',
+        description: operation.description || '',
+        parameters: [...(pathItem.parameters || []), ...(operation.parameters || [])],
+        operation,
+      });
+    }
+  }
+  operationsCache.set(spec, operations);
+  return operations;
+}
+
+/**
+ * Webhooks (events IQM sends to the client) as `{name, method, operation,
+ * operationId, tags, summary, description}`, `name` being the event type
+ */
+function listWebhooks(spec) {
+  const webhooks = [];
+  for (const [name, pathItem] of Object.entries(spec.webhooks || spec[WEBHOOKS_EXTENSION] || {})) {
+    for (const method of HTTP_METHODS) {
+      const operation = pathItem[method];
+      if (!operation) continue;
+      webhooks.push({
+        name,
+        method: method.toUpperCase(),
+        operationId: operation.operationId,
+        tags: operation.tags || [],
+        summary: operation.summary || '',
+        description: operation.description || '',
+        operation,
+      });
+    }
+  }
+  return webhooks;
+}
+
+/** Find an operation by `operationId` or by `method` + `path` */
+function findOperation(spec, {operationId, method, path: apiPath}) {
+  const operations = listOperations(spec);
+  if (operationId) {
+    return operations.find((op) => op.operationId === operationId);
+  }
+  if (method && apiPath) {
+    const key = operationKey(method === 'DEL' ? 'delete' : method, apiPath);
+    return operations.find((op) => op.key === key);
+  }
+  return undefined;
+}
+
+function resolveRef(spec, schema, seen = new Set()) {
+  let current = schema;
+  while (current && current.$ref) {
+    if (seen.has(current.$ref)) return {};
+    seen.add(current.$ref);
+    const segments = current.$ref.replace(/^#\//, '').split('/');
+    current = segments.reduce((node, key) => (node ? node[key] : undefined), spec);
+  }
+  return current || {};
+}
+
+/** Merge `allOf` members into a single object schema */
+function normalizeSchema(spec, schema) {
+  const resolved = resolveRef(spec, schema);
+  if (!resolved.allOf) return resolved;
+  return resolved.allOf.reduce(
+    (merged, member) => {
+      const part = normalizeSchema(spec, member);
+      return {
+        ...merged,
+        ...part,
+        properties: {...merged.properties, ...part.properties},
+        required: [...(merged.required || []), ...(part.required || [])],
+      };
+    },
+    {type: 'object', properties: {}, required: []},
+  );
+}
+
+/** Type label in the wording used across the guideline pages */
+function describeType(spec, schema) {
+  const resolved = normalizeSchema(spec, schema);
+  if (resolved.type === 'array') {
+    const items = normalizeSchema(spec, resolved.items || {});
+    if (!items.type && !items.properties) return 'array';
+    const itemType = items.type || 'object';
+    return `array of ${itemType === 'object' ? 'objects' : `${itemType}s`}`;
+  }
+  if (resolved.type) return resolved.type;
+  return resolved.properties ? 'object' : 'string';
+}
+
+/**
+ * Flatten an object schema into property rows. Nested objects and arrays of
+ * objects are expanded with dotted names, down to `maxDepth` levels.
+ */
+function flattenProperties(spec, schema, {maxDepth = 3, prefix = '', depth = 0} = {}) {
+  const resolved = normalizeSchema(spec, schema);
+  const target =
+    resolved.type === 'array' ? normalizeSchema(spec, resolved.items || {}) : resolved;
+  const required = new Set(target.required || []);
+  const rows = [];
+  for (const [name, propSchema] of Object.entries(target.properties || {})) {
+    const prop = normalizeSchema(spec, propSchema);
+    const fullName = prefix ? `${prefix}.${name}` : name;
+    rows.push({
+      name: fullName,
+      type: describeType(spec, prop),
+      description: prop.description || prop.title || '',
+      required: required.has(name),
+      enum: prop.enum,
+      depth,
+    });
+    const nested =
+      prop.type === 'array' ? normalizeSchema(spec, prop.items || {}) : prop;
+    if (nested.properties && depth + 1 < maxDepth) {
+      rows.push(...flattenProperties(spec, nested, {maxDepth, prefix: fullName, depth: depth + 1}));
+    }
+  }
+  return rows;
+}
+
+/** The first JSON media type object of a request body or response */
+function jsonContent(content = {}) {
+  const type = Object.keys(content).find((t) => /json/i.test(t)) || Object.keys(content)[0];
+  return type ? content[type] : undefined;
+}
+
+function firstExample(media) {
+  if (!media) return undefined;
+  if (media.example !== undefined) return media.example;
+  const examples = Object.values(media.examples || {});
+  if (examples.length > 0) return examples[0].value;
+  const schema = media.schema || {};
+  return schema.example;
+}
+
+/**
+ * The IQM APIs wrap payloads in `{statusCode, responseObject}` or
+ * `{success, data}` envelopes; the properties tables document the payload.
+ */
+function unwrapEnvelope(spec, schema) {
+  const resolved = normalizeSchema(spec, schema);
+  const props = resolved.properties || {};
+  const inner = props.responseObject || props.data;
+  return inner ? normalizeSchema(spec, inner) : resolved;
+}
+
+/** Placeholder payload built from a schema when the spec has no example */
+function sampleFromSchema(spec, schema, depth = 0) {
+  const resolved = normalizeSchema(spec, schema);
+  if (resolved.example !== undefined) return resolved.example;
+  if (resolved.enum && resolved.enum.length > 0) return resolved.enum[0];
+  if (depth > 4) return null;
+  switch (resolved.type) {
+    case 'array':
+      return [sampleFromSchema(spec, resolved.items || {}, depth + 1)];
+    case 'integer':
+    case 'number':
+      return 0;
+    case 'boolean':
+      return false;
+    case 'string':
+      return 'string';
+    default:
+      return Object.fromEntries(
+        Object.entries(resolved.properties || {}).map(([name, prop]) => [
+          name,
+          sampleFromSchema(spec, prop, depth + 1),
+        ]),
+      );
+  }
+}
+
+function successResponse(operation) {
+  const responses = operation.responses || {};
+  const status = Object.keys(responses).find((code) => /^2\d\d$/.test(code));
+  return status ? {status, response: responses[status]} : undefined;
+}
+
+function documentedParameters(spec, parameters) {
+  return parameters
+    .map((param) => resolveRef(spec, param))
+    .filter((param) => !(param.in === 'header' && AUTH_HEADER_PATTERN.test(param.name)));
+}
+
+/** Pagination parameters of an operation, from its query parameters or JSON body */
+function paginationParameters(spec, {operation, parameters}) {
+  const schemas = new Map();
+  const locations = new Map();
+  for (const param of parameters.map((entry) => resolveRef(spec, entry))) {
+    if (param.in !== 'query') continue;
+    schemas.set(param.name, resolveRef(spec, param.schema || {}));
+    locations.set(param.name, 'query');
+  }
+  const media = operation.requestBody && jsonContent(operation.requestBody.content);
+  const body = media && media.schema ? normalizeSchema(spec, media.schema) : {};
+  for (const [name, schema] of Object.entries(body.properties || {})) {
+    if (schemas.has(name)) continue;
+    schemas.set(name, normalizeSchema(spec, schema));
+    locations.set(name, 'body');
+  }
+  const sizeParam = PAGE_SIZE_PARAMS.find((name) => schemas.has(name));
+  if (!sizeParam) return undefined;
+  const size = schemas.get(sizeParam);
+  return {
+    pagination: schemas.has('offset') ? 'offset' : schemas.has('pageNo') ? 'pageNo' : undefined,
+    pageSizeParam: sizeParam,
+    pageParamsIn: locations.get(sizeParam),
+    defaultPageSize: typeof size.default === 'number' && size.default > 0 ? size.default : undefined,
+    maxPageSize: typeof size.maximum === 'number' ? size.maximum : undefined,
+  };
+}
+
+const defined = (object) => Object.fromEntries(Object.entries(object).filter(([, value]) => value !== undefined));
+
+/**
+ * Limits of an operation (from `listOperations`): the `x-operational-limits`
+ * of the spec root, of its tags and of the operation, most specific first,
+ * plus what its pagination parameters tell. Page size limits only apply to
+ * paginated operations.
+ */
+function operationalLimits(spec, operation) {
+  const {maxPageSize: rootMaxPageSize, ...root} = spec[LIMITS_EXTENSION] || {};
+  const tagLimits = (spec.tags || [])
+    .filter((tag) => operation.tags.includes(tag.name))
+    .map((tag) => tag[LIMITS_EXTENSION] || {});
+  const paging = paginationParameters(spec, operation);
+  const limits = {
+    ...root,
+    ...(paging && defined({...paging, maxPageSize: paging.maxPageSize ?? rootMaxPageSize})),
+    ...Object.assign({}, ...tagLimits),
+    ...operation.operation[LIMITS_EXTENSION],
+  };
+  return defined(limits);
+}
+
+/**
+ * A per-API `spec` completed from `reference` (openapi.json): `defaults` has
+ * the reference's root and tag limits when `spec` has none, and each of
+ * `operations` also carries the own limits of the same reference operation
+ */
+function withReferenceLimits(spec, reference) {
+  const defaults = {
+    ...spec,
+    [LIMITS_EXTENSION]: spec[LIMITS_EXTENSION] || reference[LIMITS_EXTENSION],
+    tags: spec.tags || reference.tags,
+  };
+  const referenceOperations = new Map(listOperations(reference).map((operation) => [operation.key, operation]));
+  const operations = listOperations(spec).map((operation) => {
+    const referenceOperation = referenceOperations.get(operation.key);
+    const own = {
+      ...(referenceOperation && referenceOperation.operation[LIMITS_EXTENSION]),
+      ...operation.operation[LIMITS_EXTENSION],
+    };
+    return {...operation, operation: {...operation.operation, [LIMITS_EXTENSION]: own}};
+  });
+  return {defaults, operations};
+}
+
+/** Copy of `spec` with the resolved limits on every operation, defaults taken from `reference` */
+function withOperationalLimits(spec, reference) {
+  const {defaults, operations} = withReferenceLimits(spec, reference);
+  const resolved = structuredClone(spec);
+  for (const operation of operations) {
+    resolved.paths[operation.path][operation.method.toLowerCase()][LIMITS_EXTENSION] = operationalLimits(
+      defaults,
+      operation,
+    );
+  }
+  return resolved;
+}
+
+module.exports = {
+  DEFAULT_SPEC_PATH,
+  DEFAULT_API_ORIGIN,
+  HTTP_METHODS,
+  LIMITS_EXTENSION,
+  WEBHOOKS_EXTENSION,
+  loadSpec,
+  operationKey,
+  listOperations,
+  listWebhooks,
+  findOperation,
+  resolveRef,
+  normalizeSchema,
+  describeType,
+  flattenProperties,
+  jsonContent,
+  firstExample,
+  unwrapEnvelope,
+  sampleFromSchema,
+  successResponse,
+  documentedParameters,
+  paginationParameters,
+  operationalLimits,
+  withReferenceLimits,
+  withOperationalLimits,
+};
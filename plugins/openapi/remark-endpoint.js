@@ -0,0 +1,498 @@
+/**
+ * Remark plugin that expands spec-driven placeholders at MDX compile time:
+ *
+ *   <OpenApiEndpoint operationId="getAllAssets" />
+ *   <OpenApiEndpoint method="GET" path="/api/v3/asset/list" />
+ *   <OpenApiEndpoint method="DELETE" path="/api/v3/asset/{assetId}">
+ *
+ *   Delete single Asset by ID.
+ *
+ *   ```ts
+ *   ...
+ *   ```
+ *
+ *   </OpenApiEndpoint>
+ *   <OpenApiProperties operationId="getAssetDetails" title="Asset Resource Properties" />
+ *   <OpenApiLimits tag="Report API" />
+ *   <OpenApiLimits spec="mcp-inventory.json" />
+ *   <OpenApiSdkSample method="GET" path="/api/v3/ra/reports/list" />
+ *   <OpenApiWebhook event="matched-audience.status-changed" />
+ *
+ * The placeholders are replaced with plain markup (CopyUrl badge, parameter
+ * tables, an `objectProperties` table and titled JSON samples) generated from
+ * `static/openapi/openapi.json`, so the page neither hand-maintains those
+ * tables nor hydrates a `<Tabs>` tree per endpoint. Markdown written inside
+ * `<OpenApiEndpoint>` is kept: its leading paragraphs replace the spec's
+ * description, and its code samples follow the JSON ones. `<OpenApiLimits>` lists
+ * the `x-operational-limits` of a tag's operations (rate limit, pagination,
+ * page and batch sizes, typical latency), or with `spec="mcp-inventory.json"`
+ * those of the page's endpoints in a per-API specification. `<OpenApiSdkSample>` becomes the
+ * TypeScript sample calling the operation through the SDK generated by
+ * scripts/generate-sdk.js, from the per-API `mcp-*.json` specifications.
+ * `<OpenApiWebhook>` documents an event of the spec's `x-webhooks`: when
+ * it is sent, the payload properties and a sample payload.
+ *
+ * Every `<CopyUrl>` of a list endpoint (GET, or POST, taking `pageNo` or
+ * `offset` and a page size) gets `paging="pageNo noOfEntries query"`, from which
+ * its "Try it" runner offers to walk the pages.
+ */
+
+const fs = require('fs');
+const path = require('path');
+const {
+  DEFAULT_SPEC_PATH,
+  DEFAULT_API_ORIGIN,
+  loadSpec,
+  findOperation,
+  describeType,
+  flattenProperties,
+  jsonContent,
+  firstExample,
+  unwrapEnvelope,
+  sampleFromSchema,
+  successResponse,
+  documentedParameters,
+  listOperations,
+  listWebhooks,
+  operationKey,
+  operationalLimits,
+  paginationParameters,
+  withReferenceLimits,
+  LIMITS_EXTENSION,
+} = require('./lib/spec');
+const {
+  text,
+  inlineCode,
+  inlineMarkdown,
+  lineBreak,
+  paragraph,
+  jsxFlow,
+  jsxText,
+  readAttributes,
+  parameterTable,
+  propertiesDetails,
+  dataTable,
+  codeBlock,
+} = require('./lib/mdast');
+const {DEFAULT_SPEC_DIR, loadModules, findSdkOperation, sdkSample} = require('./lib/sdk');
+const {setDependencies} = require('../lib/module-dependencies');
+
+const ENDPOINT_TAG = 'OpenApiEndpoint';
+const PROPERTIES_TAG = 'OpenApiProperties';
+const LIMITS_TAG = 'OpenApiLimits';
+const SDK_SAMPLE_TAG = 'OpenApiSdkSample';
+const WEBHOOK_TAG = 'OpenApiWebhook';
+
+function resolveOperation(spec, node, file) {
+  const attributes = readAttributes(node);
+  const operation = findOperation(spec, attributes);
+  if (!operation) {
+    const wanted = attributes.operationId || `${attributes.method} ${attributes.path}`;
+    throw new Error(
+      `<${node.name}> in ${file.path}: no operation "${wanted}" in the OpenAPI specification.`,
+    );
+  }
+  return {attributes, operation};
+}
+
+function parameterRows(spec, parameters, location) {
+  return parameters
+    .filter((param) => param.in === location)
+    .map((param) => ({
+      name: param.name,
+      type: describeType(spec, param.schema || {type: 'string'}),
+      description: param.description || '',
+      required: Boolean(param.required),
+      enum: param.schema && param.schema.enum,
+    }));
+}
+
+function responseRows(spec, operation) {
+  const success = successResponse(operation);
+  const media = success && jsonContent(success.response.content);
+  if (!media || !media.schema) return [];
+  return flattenProperties(spec, unwrapEnvelope(spec, media.schema));
+}
+
+function stringify(value) {
+  return JSON.stringify(value, null, 2);
+}
+
+const isSample = (node) =>
+  node.type === 'code' ||
+  (node.type === 'mdxJsxFlowElement' && node.name === SDK_SAMPLE_TAG) ||
+  (node.children || []).some(isSample);
+
+/**
+ * Sorts the authored children of `<OpenApiEndpoint>`: code samples (with
+ * the paragraph introducing each) go after the JSON samples, the leading
+ * paragraphs replace the spec's description, and the rest (notes, buttons)
+ * follows the tables.
+ */
+function authoredParts(children) {
+  const parts = {description: [], notes: [], samples: []};
+  children.forEach((node, i) => {
+    const next = children[i + 1];
+    if (isSample(node) || (node.type === 'paragraph' && next && isSample(next))) {
+      parts.samples.push(node);
+    } else if (node.type === 'paragraph' && parts.notes.length === 0 && parts.samples.length === 0) {
+      parts.description.push(node);
+    } else {
+      parts.notes.push(node);
+    }
+  });
+  return parts;
+}
+
+function endpointNodes(spec, {operation, attributes}, origin, children = []) {
+  const {operation: raw, parameters} = operation;
+  const params = documentedParameters(spec, parameters);
+  const authored = authoredParts(children);
+
+  const details = [...authored.description];
+  if (details.length === 0) {
+    const description = attributes.description || operation.description || operation.summary;
+    for (const block of description.split(/\n\s*\n/).filter(Boolean)) {
+      details.push(paragraph(inlineMarkdown(block.trim())));
+    }
+  }
+  for (const [location, title] of [
+    ['path', 'Path Parameters'],
+    ['query', 'Query Parameters'],
+    ['header', 'Headers'],
+  ]) {
+    const rows = parameterRows(spec, params, location);
+    if (rows.length > 0) details.push(parameterTable(title, rows));
+  }
+
+  const samples = [];
+  const requestMedia = raw.requestBody && jsonContent(raw.requestBody.content);
+  if (requestMedia && requestMedia.schema) {
+    const rows = flattenProperties(spec, requestMedia.schema, {maxDepth: 2});
+    if (rows.length > 0) details.push(parameterTable('Request Schema', rows));
+    const example = firstExample(requestMedia);
+    samples.push(
+      codeBlock(
+        'json',
+        'Request Sample',
+        stringify(example !== undefined ? example : sampleFromSchema(spec, requestMedia.schema)),
+      ),
+    );
+  }
+
+  const properties = responseRows(spec, raw);
+  if (properties.length > 0) {
+    details.push(propertiesDetails('Response Properties', properties));
+  }
+
+  const success = successResponse(raw);
+  if (success) {
+    const media = jsonContent(success.response.content);
+    let value = firstExample(media);
+    if (value === undefined && media && media.schema) {
+      value = sampleFromSchema(spec, media.schema);
+    }
+    if (value !== undefined) {
+      samples.push(codeBlock('json', `Response ${success.status}`, stringify(value)));
+    }
+  }
+  details.push(...authored.notes);
+  samples.push(...authored.samples);
+
+  return [
+    jsxFlow('CopyUrl', {method: operation.method, url: `${origin}${operation.path}`}),
+    jsxFlow('div', {className: 'openapi-endpoint endpoint-container'}, [
+      jsxFlow('div', {className: 'child1'}, details),
+      jsxFlow('div', {className: 'child2'}, samples),
+    ]),
+  ];
+}
+
+function propertiesNodes(spec, {operation, attributes}) {
+  const rows = responseRows(spec, operation.operation);
+  return [
+    jsxFlow('div', {className: 'openapi-endpoint'}, [
+      propertiesDetails(attributes.title || 'Resource Properties', rows),
+    ]),
+  ];
+}
+
+const number = (value) => value.toLocaleString('en-US');
+const cellText = (value) => (value === undefined ? [text('—')] : [text(value)]);
+
+function rateLimitText({requests, per}) {
+  return `${number(requests)} requests per ${per}`;
+}
+
+function sizeText(bytes) {
+  const units = ['B', 'KB', 'MB', 'GB'];
+  let value = bytes;
+  let unit = 0;
+  while (value >= 1024 && unit < units.length - 1) {
+    value /= 1024;
+    unit += 1;
+  }
+  return `${Number.isInteger(value) ? value : value.toFixed(1)} ${units[unit]}`;
+}
+
+/** Limits every operation of the tag shares, as a sentence */
+function sharedLimitsText(spec, tag) {
+  const shared = {
+    ...spec[LIMITS_EXTENSION],
+    ...((spec.tags || []).find((entry) => entry.name === tag) || {})[LIMITS_EXTENSION],
+  };
+  const sentences = [];
+  if (shared.rateLimit) {
+    sentences.push(
+      `Every endpoint of this API is limited to ${rateLimitText(shared.rateLimit)}; beyond that, requests fail with 429 Too Many Requests.`,
+    );
+  }
+  if (shared.maxPageSize) {
+    sentences.push(`Paginated endpoints return at most ${number(shared.maxPageSize)} entries per page.`);
+  }
+  return sentences.join(' ');
+}
+
+/** `METHOD /path` of the endpoints a page documents: its CopyUrl badges and <OpenApiEndpoint>s */
+function documentedKeys(tree, spec, origin) {
+  const keys = new Set();
+  (function visit(node) {
+    if (node.type === 'mdxJsxFlowElement' || node.type === 'mdxJsxTextElement') {
+      const attributes = readAttributes(node);
+      if (node.name === 'CopyUrl' && attributes.method && typeof attributes.url === 'string') {
+        keys.add(operationKey(attributes.method, attributes.url.replace(origin, '').replace(/\?.*$/, '')));
+      } else if (node.name === ENDPOINT_TAG) {
+        const operation = findOperation(spec, attributes);
+        if (operation) keys.add(operation.key);
+      }
+    }
+    (node.children || []).forEach(visit);
+  })(tree);
+  return keys;
+}
+
+/**
+ * Operations of `<OpenApiLimits>`: those of `tag` in openapi.json and,
+ * with `spec`, those of a per-API specification, with the limits of
+ * openapi.json. `onPage` keeps the ones the page documents, for pages that
+ * share a specification.
+ */
+function limitsOperations(reference, {tag, spec: specName, onPage}, specDir, documented, file, read) {
+  const tagged = tag ? listOperations(reference).filter((operation) => operation.tags.includes(tag)) : [];
+  if (!specName) {
+    if (!tagged.length) {
+      throw new Error(`<${LIMITS_TAG}> in ${file.path}: no operation tagged "${tag}" in the OpenAPI specification.`);
+    }
+    return {spec: reference, operations: tagged};
+  }
+  const specPath = path.join(specDir, specName);
+  if (!fs.existsSync(specPath)) {
+    throw new Error(`<${LIMITS_TAG}> in ${file.path}: no specification ${specName} in ${specDir}.`);
+  }
+  read.add(specPath);
+  const {defaults, operations} = withReferenceLimits(loadSpec(specPath), reference);
+  const keys = new Set(operations.map((operation) => operation.key));
+  // Tagged operations the per-API specification doesn't have yet (e.g. a v2 path it replaced)
+  const all = [...operations, ...tagged.filter((operation) => !keys.has(operation.key))];
+  return {spec: defaults, operations: onPage ? all.filter((operation) => documented().has(operation.key)) : all};
+}
+
+function limitsNodes({spec, operations}, {tag}) {
+  const rows = [];
+  for (const operation of operations) {
+    const limits = operationalLimits(spec, operation);
+    const {rateLimit, ...specific} = limits;
+    // Operations with nothing beyond the shared rate limit aren't listed
+    if (!Object.keys(specific).length && !operation.operation[LIMITS_EXTENSION]?.rateLimit) continue;
+    const pageSize = limits.pageSizeParam
+      ? `${limits.defaultPageSize ? number(limits.defaultPageSize) : '—'} / ${limits.maxPageSize ? number(limits.maxPageSize) : '—'}`
+      : undefined;
+    const batch = [
+      limits.batchSize && `${number(limits.batchSize)} per request`,
+      limits.maxRecords && `${number(limits.maxRecords)} records`,
+      limits.maxUploadBytes && `${sizeText(limits.maxUploadBytes)} upload`,
+    ].filter(Boolean);
+    const latency = limits.typicalLatencyMs;
+    rows.push([
+      [inlineCode(`${operation.method} ${operation.path}`), lineBreak(), text(operation.summary)],
+      limits.pageSizeParam
+        ? [inlineCode(limits.pagination || 'pageNo'), text(' + '), inlineCode(limits.pageSizeParam)]
+        : cellText(undefined),
+      cellText(pageSize),
+      cellText(batch.length ? batch.join(', ') : limits.bulk ? 'bulk' : undefined),
+      cellText(operation.operation[LIMITS_EXTENSION]?.rateLimit ? rateLimitText(rateLimit) : undefined),
+      cellText(latency && `${number(latency.p50)} ms (p95 ${number(latency.p95)} ms)`),
+    ]);
+  }
+  const summary = sharedLimitsText(spec, tag);
+  return [
+    jsxFlow('div', {className: 'openapi-limits'}, [
+      ...(summary ? [paragraph([text(summary)])] : []),
+      dataTable(
+        ['Endpoint', 'Pagination', 'Page size (default / max)', 'Batch', 'Own rate limit', 'Typical latency'],
+        rows,
+      ),
+    ]),
+  ];
+}
+
+function webhookNodes(spec, {event}, file) {
+  const webhook = listWebhooks(spec).find((candidate) => candidate.name === event);
+  if (!webhook) {
+    throw new Error(`<${WEBHOOK_TAG}> in ${file.path}: no webhook "${event}" in the OpenAPI specification.`);
+  }
+  const {operation} = webhook;
+  const media = operation.requestBody && jsonContent(operation.requestBody.content);
+
+  const details = (webhook.description || webhook.summary)
+    .split(/\n\s*\n/)
+    .filter(Boolean)
+    .map((block) => paragraph(inlineMarkdown(block.trim())));
+  const headers = parameterRows(spec, documentedParameters(spec, operation.parameters || []), 'header');
+  if (headers.length > 0) details.push(parameterTable('Headers', headers));
+  if (media && media.schema) {
+    details.push(propertiesDetails('Payload Properties', flattenProperties(spec, media.schema)));
+  }
+  const replies = Object.entries(operation.responses || {}).map(([status, response]) => [
+    [inlineCode(status === 'default' ? 'Other' : status)],
+    [text(response.description || '')],
+  ]);
+  if (replies.length) details.push(dataTable(['Your Reply', ''], replies));
+
+  const samples = [];
+  if (media) {
+    const example = firstExample(media);
+    const value = example !== undefined ? example : media.schema && sampleFromSchema(spec, media.schema);
+    if (value !== undefined) samples.push(codeBlock('json', 'Payload Sample', stringify(value)));
+  }
+
+  return [
+    paragraph([
+      jsxText('span', {className: 'badge badge--secondary'}, [text(webhook.method)]),
+      text(' '),
+      inlineCode(webhook.name),
+      // Events under design, not sent by the API yet
+      ...(operation['x-status'] === 'proposed'
+        ? [text(' '), jsxText('span', {className: 'badge badge--warning'}, [text('Proposed')])]
+        : []),
+    ]),
+    jsxFlow('div', {className: 'openapi-endpoint endpoint-container'}, [
+      jsxFlow('div', {className: 'child1'}, details),
+      jsxFlow('div', {className: 'child2'}, samples),
+    ]),
+  ];
+}
+
+function sdkSampleNodes(modules, node, file, specDir, read) {
+  const attributes = readAttributes(node);
+  let found;
+  if (attributes.operationId) {
+    for (const [domain, module] of modules) {
+      const operation = module.operations.find((candidate) => candidate.operationId === attributes.operationId);
+      if (operation) {
+        found = {domain, module, operation};
+        break;
+      }
+    }
+  } else if (attributes.method && attributes.path) {
+    found = findSdkOperation(modules, attributes.method, attributes.path);
+  }
+  if (!found) {
+    const wanted = attributes.operationId || `${attributes.method} ${attributes.path}`;
+    throw new Error(`<${SDK_SAMPLE_TAG}> in ${file.path}: no operation "${wanted}" in the per-API specifications.`);
+  }
+  const {domain, module, operation} = found;
+  // The module's operations carry the limits of the reference spec
+  read.add(path.join(specDir, module.file));
+  read.add(path.join(specDir, path.basename(DEFAULT_SPEC_PATH)));
+  return [codeBlock('ts', attributes.title, sdkSample(domain, module.spec, operation))];
+}
+
+/** `paging` attribute of the CopyUrl badges of list endpoints, see the header */
+function annotatePaging(tree, getSpec, origin) {
+  (function visit(node) {
+    if ((node.type === 'mdxJsxFlowElement' || node.type === 'mdxJsxTextElement') && node.name === 'CopyUrl') {
+      const attributes = readAttributes(node);
+      const method = String(attributes.method || 'GET').toUpperCase();
+      if (typeof attributes.url === 'string' && !attributes.paging && (method === 'GET' || method === 'POST')) {
+        const apiPath = attributes.url.replace(origin, '').replace(/\?.*$/, '');
+        const spec = getSpec();
+        const operation = findOperation(spec, {method, path: apiPath});
+        const paging = operation && paginationParameters(spec, operation);
+        // fetch() can't send a GET body, whatever the spec says
+        if (paging && paging.pagination && (method === 'POST' || paging.pageParamsIn === 'query')) {
+          node.attributes.push({
+            type: 'mdxJsxAttribute',
+            name: 'paging',
+            value: `${paging.pagination} ${paging.pageSizeParam} ${paging.pageParamsIn}`,
+          });
+        }
+      }
+    }
+    (node.children || []).forEach(visit);
+  })(tree);
+}
+
+function transform(parent, expand) {
+  if (!parent.children) return;
+  for (let i = 0; i < parent.children.length; i += 1) {
+    const child = parent.children[i];
+    // Placeholders nested in a placeholder, e.g. an <OpenApiSdkSample> in an <OpenApiEndpoint>
+    transform(child, expand);
+    const replacement = expand(child);
+    if (replacement) {
+      parent.children.splice(i, 1, ...replacement);
+      i += replacement.length - 1;
+    }
+  }
+}
+
+module.exports = function remarkOpenApiEndpoint(options = {}) {
+  const specPath = options.specPath || DEFAULT_SPEC_PATH;
+  const origin = options.origin || DEFAULT_API_ORIGIN;
+  const sdkSpecDir = options.sdkSpecDir || DEFAULT_SPEC_DIR;
+
+  return (tree, file) => {
+    // The specifications read for this page, reported as its dependencies
+    const read = new Set();
+    const mainSpec = () => {
+      read.add(specPath);
+      return loadSpec(specPath);
+    };
+    // Read when the first <OpenApiLimits> expands; <OpenApiEndpoint>s count
+    // whether they are already CopyUrl badges by then or not
+    let documented;
+    const documentedOnPage = () => {
+      documented = documented || documentedKeys(tree, mainSpec(), origin);
+      return documented;
+    };
+    transform(tree, (node) => {
+      if (node.type !== 'mdxJsxFlowElement') return undefined;
+      if (node.name === ENDPOINT_TAG) {
+        const spec = mainSpec();
+        return endpointNodes(spec, resolveOperation(spec, node, file), origin, node.children);
+      }
+      if (node.name === PROPERTIES_TAG) {
+        const spec = mainSpec();
+        return propertiesNodes(spec, resolveOperation(spec, node, file));
+      }
+      if (node.name === LIMITS_TAG) {
+        const attributes = readAttributes(node);
+        return limitsNodes(
+          limitsOperations(mainSpec(), attributes, sdkSpecDir, documentedOnPage, file, read),
+          attributes,
+        );
+      }
+      if (node.name === WEBHOOK_TAG) {
+        return webhookNodes(mainSpec(), readAttributes(node), file);
+      }
+      if (node.name === SDK_SAMPLE_TAG) {
+        return sdkSampleNodes(loadModules(sdkSpecDir), node, file, sdkSpecDir, read);
+      }
+      return undefined;
+    });
+    // After the expansion, which adds the badges of <OpenApiEndpoint>s
+    annotatePaging(tree, mainSpec, origin);
+    setDependencies(file, 'openapi', read);
+  };
+};
@@ -0,0 +1,109 @@
+/**
+ * Docusaurus plugin that turns the rules in `./rules` into redirects after
+ * each build, replacing the `createRedirects` callback of
+ * @docusaurus/plugin-client-redirects:
+ *
+ * - `redirects.json`: every redirect as `{from, to, status}`
+ * - `_redirects`: the same as 301s, for hosts that redirect server-side
+ *   (Netlify, Cloudflare Pages)
+ * - with `stubs: true`, an HTML page per legacy URL that bounces to the new
+ *   one, for static hosts such as GitHub Pages
+ *
+ * Old URLs with a space used to get a second stub for their `%20` spelling;
+ * servers decode the request path before looking up a file, so the spaced
+ * stub serves both.
+ */
+
+const fs = require('fs');
+const path = require('path');
+const rules = require('./rules');
+
+const STATUS = 301;
+
+const withTrailingSlash = (route) => (route.endsWith('/') ? route : `${route}/`);
+
+const pascalCase = (segment) =>
+  segment
+    .split('-')
+    .map((word) => word.charAt(0).toUpperCase() + word.slice(1).toLowerCase())
+    .join('-');
+
+/** `[{from, to}]` for the routes of the build, sorted by `from` */
+function computeRedirects(routesPaths, {moved = [], sections = []} = rules) {
+  const routes = new Set(routesPaths.map(withTrailingSlash));
+  const redirects = new Map();
+  const add = (from, to) => {
+    if (routes.has(from) || redirects.has(from)) return;
+    redirects.set(from, to);
+  };
+
+  for (const {from, to} of moved) {
+    const target = withTrailingSlash(to);
+    if (!routes.has(target)) throw new Error(`Redirect from "${from}" targets "${to}", which is not a route.`);
+    add(withTrailingSlash(from), target);
+  }
+
+  for (const route of [...routes].sort()) {
+    for (const section of sections) {
+      const prefix = `/${section.to}/`;
+      if (!route.startsWith(prefix)) continue;
+      const rest = route.slice(prefix.length).split('/').filter(Boolean).map(pascalCase);
+      add(`/${section.from}/${rest.map((part) => `${part}/`).join('')}`, route);
+    }
+  }
+
+  return [...redirects]
+    .sort(([a], [b]) => a.localeCompare(b))
+    .map(([from, to]) => ({from, to}));
+}
+
+const escapeHtml = (value) => value.replace(/&/g, '&amp;').replace(/"/g, '&quot;').replace(/</g, '&lt;');
+
+function stubHtml(url) {
+  const href = escapeHtml(url);
+  return `<!DOCTYPE html>
+<html>
+<head>
+<meta charset="UTF-8">
+<meta http-equiv="refresh" content="0; url=${href}">
+<link rel="canonical" href="${href}">
+<title>Redirecting…</title>
+</head>
+<script>window.location.replace(${JSON.stringify(url)} + window.location.search + window.location.hash);</script>
+</html>
+`;
+}
+
+module.exports = function redirectsPlugin(context, options = {}) {
+  const {baseUrl} = context.siteConfig;
+  const {stubs = true} = options;
+  const siteUrl = (route) => `${baseUrl}${route.replace(/^\//, '')}`;
+
+  return {
+    name: 'redirects',
+
+    async postBuild({outDir, routesPaths}) {
+      const routes = routesPaths.map((route) => `/${route.slice(baseUrl.length)}`);
+      const redirects = computeRedirects(routes).map(({from, to}) => ({
+        from: siteUrl(from),
+        to: siteUrl(to),
+        status: STATUS,
+      }));
+
+      fs.writeFileSync(path.join(outDir, 'redirects.json'), `${JSON.stringify({redirects}, null, 2)}\n`);
+      fs.writeFileSync(
+        path.join(outDir, '_redirects'),
+        redirects.map(({from, to, status}) => `${encodeURI(from)} ${encodeURI(to)} ${status}`).join('\n') + '\n',
+      );
+
+      if (!stubs) return;
+      for (const {from, to} of redirects) {
+        const filePath = path.join(outDir, from.slice(baseUrl.length), 'index.html');
+        fs.mkdirSync(path.dirname(filePath), {recursive: true});
+        fs.writeFileSync(filePath, stubHtml(to));
+      }
+    },
+  };
+};
+
+module.exports.computeRedirects = computeRedirects;
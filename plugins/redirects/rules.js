@@ -0,0 +1,30 @@
+/**
+ * Legacy URLs of the docs, as rules for ./index.
+ */
+
+module.exports = {
+  // Pages that moved; `from` must no longer be a route
+  moved: [
+    {from: '/quickstart-guides/conversion-quickstart/', to: '/tutorials/create-a-conversion/'},
+    {from: '/quickstart-guides/matched-audience-upload-api-quickstart-guide/', to: '/tutorials/upload-a-matched-audience/'},
+    {from: '/quickstart-guides/bid-model-quickstart/', to: '/tutorials/create-a-bid-model/'},
+    {from: '/quickstart-guides/inventory-quickstart/', to: '/tutorials/optimize-your-inventory/'},
+    {from: '/quickstart-guides/insights-quickstart/', to: '/tutorials/create-an-insights-report/'},
+    {
+      from: '/quickstart-guides/upload-creative-and-create-a-campaign-api-quickstart-guide/',
+      to: '/tutorials/create-a-pg-campaign/',
+    },
+  ],
+
+  // Sections that used to be served from Title Case folders, with Pascal
+  // Case page names: `/Getting Started/Before-You-Begin/` now lives at
+  // `/getting-started/before-you-begin/`. Every route under `to` gets a
+  // redirect from its old URL.
+  sections: [
+    {from: 'Getting Started', to: 'getting-started'},
+    {from: 'Healthcare Vertical', to: 'healthcare-vertical'},
+    {from: 'Political Vertical', to: 'political-vertical'},
+    {from: 'Quickstart Guides', to: 'quickstart-guides'},
+    {from: 'Migration Guides', to: 'migration-guides'},
+  ],
+};
@@ -0,0 +1,157 @@
+/**
+ * Docusaurus plugin that writes a local search index to `search/` after
+ * each build, queried offline by src/components/LocalSearch:
+ *
+ * - one shard per top-level section (`search/guidelines.<hash>.json`, ...)
+ *   listing every page and `##`–`####` heading with its endpoint path and
+ *   HTTP method and the property names of its tables
+ * - `search/manifest.json` with the URL of each shard
+ *
+ * The index is read from the rendered HTML of the docs, so the content that
+ * only exists once built (`<OpenApiEndpoint>` sections generated from the
+ * specifications, shared partials, `<LazyEndpoint>` chunks) is searchable.
+ *
+ * Shard file names carry their content hash: after a deploy, clients only
+ * download the shards whose content changed.
+ */
+
+const crypto = require('crypto');
+const fs = require('fs');
+const path = require('path');
+const {DEFAULT_API_ORIGIN} = require('../openapi/lib/spec');
+
+const SEARCH_DIR = 'search';
+const MANIFEST = 'manifest.json';
+const HASH_LENGTH = 10;
+
+// First route segment -> shard; everything else goes to `general`
+const SHARDS = {
+  guidelines: 'guidelines',
+  'quickstart-guides': 'quickstart-guides',
+  tutorials: 'tutorials',
+  'healthcare-vertical': 'verticals',
+  'political-vertical': 'verticals',
+};
+const DEFAULT_SHARD = 'general';
+
+const shardOf = (route) => SHARDS[route.split('/')[1]] || DEFAULT_SHARD;
+
+// Rendered by DocItem around the page's MDX, up to its footer
+const DOC_CONTENT = /<div class="theme-doc-markdown markdown">([\s\S]*?)<\/article>/;
+// Set on `unlisted` docs
+const NOINDEX = /<meta name="robots" content="noindex/;
+// In document order: a heading, the "Try it" button of a <CopyUrl> badge
+// (which spells out its method and URL), or the name in the first cell of
+// a table row (<td>`budgetTotal` <br />...)
+const OUTLINE = new RegExp(
+  [
+    /<h([1-4])\b([^>]*)>([\s\S]*?)<\/h\1>/.source,
+    /aria-label="Try ([A-Z]+) ([^"]+)"/.source,
+    /<tr\b[^>]*>\s*<td\b[^>]*>\s*<code>([A-Za-z_$][\w.$\[\]]*)<\/code>/.source,
+  ].join('|'),
+  'g',
+);
+const HASH_LINK = /<a\b[^>]*class="hash-link"[^>]*>[\s\S]*?<\/a>/g;
+
+const ENTITIES = {amp: '&', lt: '<', gt: '>', quot: '"', apos: "'", nbsp: ' '};
+
+function decodeEntities(text) {
+  return text.replace(/&(#x[\da-f]+|#\d+|\w+);/gi, (entity, name) => {
+    if (name[0] === '#') {
+      return String.fromCodePoint(name[1].toLowerCase() === 'x' ? parseInt(name.slice(2), 16) : Number(name.slice(1)));
+    }
+    return ENTITIES[name.toLowerCase()] ?? entity;
+  });
+}
+
+function textOf(html) {
+  return decodeEntities(html.replace(HASH_LINK, '').replace(/<[^>]+>/g, ''))
+    .replace(/\u200b/g, '')
+    .replace(/\s+/g, ' ')
+    .trim();
+}
+
+function apiPath(url) {
+  return url.replace(DEFAULT_API_ORIGIN, '').replace(/\?.*$/, '');
+}
+
+/** `{title, entries}` of a rendered doc page, undefined for other pages */
+function pageOutline(html) {
+  const content = html.match(DOC_CONTENT);
+  if (!content || NOINDEX.test(html)) return undefined;
+  let title;
+  let current = null;
+  const entries = [];
+  for (const [, depth, attributes, heading, method, url, property] of content[1].matchAll(OUTLINE)) {
+    if (depth === '1') {
+      title = title || textOf(heading);
+    } else if (depth) {
+      const id = attributes.match(/\sid="([^"]+)"/);
+      current = id ? {id: decodeEntities(id[1]), text: textOf(heading), properties: []} : null;
+      if (current) entries.push(current);
+    } else if (method) {
+      if (current && !current.method) {
+        current.method = method;
+        current.path = apiPath(decodeEntities(url));
+      }
+    } else if (current && !current.properties.includes(property)) {
+      current.properties.push(property);
+    }
+  }
+  return {title, entries};
+}
+
+/** Section name -> index entries */
+function buildEntries(outDir, baseUrl, routesPaths) {
+  const shards = new Map();
+  for (const url of [...routesPaths].sort()) {
+    const file = path.join(outDir, url.slice(baseUrl.length), 'index.html');
+    if (!url.endsWith('/') || !fs.existsSync(file)) continue;
+    const outline = pageOutline(fs.readFileSync(file, 'utf8'));
+    if (!outline) continue;
+    const route = `/${url.slice(baseUrl.length)}`;
+    const page = outline.title || route;
+    const items = [{url, title: page}];
+    for (const entry of outline.entries) {
+      items.push({
+        url: `${url}#${entry.id}`,
+        title: entry.text,
+        page,
+        ...(entry.method && {method: entry.method}),
+        ...(entry.path && {path: entry.path}),
+        ...(entry.properties.length && {fields: entry.properties}),
+      });
+    }
+    const shard = shardOf(route);
+    if (!shards.has(shard)) shards.set(shard, []);
+    shards.get(shard).push(...items);
+  }
+  return shards;
+}
+
+module.exports = function localSearchPlugin(context) {
+  const {baseUrl} = context.siteConfig;
+
+  return {
+    name: 'local-search',
+
+    // Synchronous on purpose: postBuilds start in plugin order, and
+    // plugins/offline precaches the files written here
+    postBuild({outDir, routesPaths}) {
+      const searchDir = path.join(outDir, SEARCH_DIR);
+      fs.mkdirSync(searchDir, {recursive: true});
+
+      const shards = [];
+      for (const [name, entries] of [...buildEntries(outDir, baseUrl, routesPaths)].sort(([a], [b]) =>
+        a.localeCompare(b),
+      )) {
+        const buffer = Buffer.from(JSON.stringify(entries));
+        const hash = crypto.createHash('sha256').update(buffer).digest('hex').slice(0, HASH_LENGTH);
+        const fileName = `${name}.${hash}.json`;
+        fs.writeFileSync(path.join(searchDir, fileName), buffer);
+        shards.push({name, url: `${baseUrl}${SEARCH_DIR}/${fileName}`, entries: entries.length});
+      }
+      fs.writeFileSync(path.join(searchDir, MANIFEST), `${JSON.stringify({shards}, null, 2)}\n`);
+    },
+  };
+};
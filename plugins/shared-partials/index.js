@@ -0,0 +1,39 @@
+/**
+ * Docusaurus plugin that moves MDX partials (`docs/_partials/**`) imported by
+ * more than one page into shared chunks.
+ *
+ * Every doc page is its own async chunk, and webpack would otherwise inline a
+ * partial into each page that imports it, so the audience partials were
+ * downloaded again on the Audience API, political and healthcare pages.
+ * Leaving the chunk unnamed lets webpack group partials by the exact set of
+ * pages that use them: one chunk per combination, fetched once and cached
+ * (file names are content-hashed).
+ */
+
+module.exports = function sharedPartialsPlugin() {
+  return {
+    name: 'shared-partials',
+
+    configureWebpack(config, isServer) {
+      if (isServer) return {};
+      return {
+        optimization: {
+          splitChunks: {
+            cacheGroups: {
+              partials: {
+                test: /[\\/]docs[\\/]_partials[\\/]/,
+                chunks: 'async',
+                minChunks: 2,
+                // Partials are small on their own but add up across pages
+                minSize: 0,
+                // Above Docusaurus' site-wide `common` group
+                priority: 50,
+                reuseExistingChunk: true,
+              },
+            },
+          },
+        },
+      };
+    },
+  };
+};
@@ -0,0 +1,141 @@
+/**
+ * Builders for `sidebars.js`.
+ *
+ * Endpoint links are generated from the docs themselves: the label comes from
+ * the section heading and the HTTP method badge from the section's
+ * `<CopyUrl>`, checked against the OpenAPI spec. Nothing about an endpoint
+ * has to be repeated in the sidebar.
+ *
+ * Labels default to the heading without its leading "Get"; override them per
+ * heading id in the doc's front matter:
+ *
+ *   ---
+ *   sidebar_labels:
+ *     get-customer-doubleverify-details: "Customer DoubleVerify IVT Flag"
+ *   ---
+ *
+ * Items carry no default `className`: level styles come from the theme's
+ * `theme-doc-sidebar-item-*-level-N` classes (see src/css/custom.css), which
+ * keeps the sidebar data every docs page loads small.
+ */
+
+const {routeOutline} = require('./outline');
+const {loadSpec, listOperations, DEFAULT_API_ORIGIN} = require('../openapi/lib/spec');
+
+const QUICKSTART_STEP_CLASS = 'sidebarItemQS';
+
+// Sidebar badges abbreviate DELETE (see src/theme/DocSidebarItem/Link)
+const badgeMethod = (method) => (method === 'DELETE' ? 'DEL' : method);
+
+let specMethods;
+
+/** HTTP methods the spec documents for each path */
+function methodsByPath() {
+  if (!specMethods) {
+    specMethods = new Map();
+    for (const {method, path} of listOperations(loadSpec())) {
+      if (!specMethods.has(path)) specMethods.set(path, []);
+      specMethods.get(path).push(method.toUpperCase());
+    }
+  }
+  return specMethods;
+}
+
+/** Method of an endpoint section: its `<CopyUrl>` unless the spec says otherwise */
+function methodOf(entry) {
+  if (!entry.method) return undefined;
+  const apiPath = (entry.url || '').replace(DEFAULT_API_ORIGIN, '').replace(/\?.*$/, '');
+  const documented = methodsByPath().get(apiPath);
+  if (documented && documented.length === 1 && !documented.includes(entry.method)) {
+    return badgeMethod(documented[0]);
+  }
+  return badgeMethod(entry.method);
+}
+
+function labelOf(entry, frontMatter) {
+  const overrides = frontMatter.sidebar_labels || {};
+  return overrides[entry.id] || entry.text.replace(/^Get (an? )?/, '');
+}
+
+function splitHref(href) {
+  const [route, anchor] = href.split('#');
+  return {route, anchor};
+}
+
+function findEntry(href) {
+  const {route, anchor} = splitHref(href);
+  const {frontMatter, entries} = routeOutline(route);
+  const entry = entries.find((candidate) => candidate.id === anchor);
+  if (!entry) {
+    throw new Error(`Sidebar links to "${href}" but ${route} has no heading with id "${anchor}".`);
+  }
+  return {entry, frontMatter};
+}
+
+function doc(id, label) {
+  return {type: 'doc', id, label};
+}
+
+function link(href, label) {
+  return {type: 'link', label, href};
+}
+
+/** Link to a step of a quickstart guide */
+function step(href, label) {
+  return {...link(href, label), className: QUICKSTART_STEP_CLASS};
+}
+
+/**
+ * Link to an endpoint section, with its method badge. `label` and `method`
+ * are only needed when the link doesn't point at an endpoint heading.
+ */
+function endpoint(href, label, method) {
+  if (label && method) {
+    return {...link(href, label), customProps: {method}};
+  }
+  const {entry, frontMatter} = findEntry(href);
+  const resolvedMethod = method || methodOf(entry);
+  if (!resolvedMethod) {
+    throw new Error(`Sidebar endpoint "${href}" has no <CopyUrl> to take its method from.`);
+  }
+  return {...link(href, label || labelOf(entry, frontMatter)), customProps: {method: resolvedMethod}};
+}
+
+/** One link per subsection of the `anchor` heading in the doc at `route` */
+function endpoints(route, anchor) {
+  const {entry: group} = findEntry(`${route}#${anchor}`);
+  const {frontMatter, entries} = routeOutline(route);
+  const items = [];
+  for (const entry of entries.slice(entries.indexOf(group) + 1)) {
+    if (entry.depth <= group.depth) break;
+    if (entry.depth !== group.depth + 1) continue;
+    const href = `${route}#${entry.id}`;
+    const method = methodOf(entry);
+    const label = labelOf(entry, frontMatter);
+    items.push(method ? {...link(href, label), customProps: {method}} : link(href, label));
+  }
+  return items;
+}
+
+/**
+ * Sidebar category. `docId` (optional) is the doc the category label links
+ * to; `options` are extra category fields such as `collapsed`.
+ */
+function category(label, docId, items, options = {}) {
+  return {
+    type: 'category',
+    label,
+    ...(docId && {link: {type: 'doc', id: docId}}),
+    ...options,
+    items,
+  };
+}
+
+module.exports = {
+  category,
+  doc,
+  link,
+  step,
+  endpoint,
+  endpoints,
+};
@@ -0,0 +1,203 @@
+/**
+ * Reads the heading outline of a doc straight from its MDX source: every
+ * `##`–`####` heading with the id Docusaurus assigns to it, the HTTP
+ * method/URL of the `<CopyUrl>` badge that opens an endpoint section (or of
+ * its `<OpenApiEndpoint>`, which renders that badge), and
+ * the property names (`<td>\`name\``) of the section's tables.
+ *
+ * Imported `_partials` rendered at the top level are expanded in place. Each
+ * partial is compiled as its own MDX module, so it gets its own slugger, just
+ * like at build time.
+ */
+
+const fs = require('fs');
+const path = require('path');
+const yaml = require('js-yaml');
+const {createSlugger} = require('@docusaurus/utils');
+const {DEFAULT_API_ORIGIN} = require('../openapi/lib/spec');
+
+const DEFAULT_DOCS_DIR = path.resolve(__dirname, '../../docs');
+// First cell of an `objectProperties` row: <td>`budgetTotal` <br />...
+const PROPERTY_CELL = /<td>\s*`([A-Za-z_$][\w.$\[\]]*)`/g;
+
+function splitFrontMatter(source) {
+  const match = source.match(/^---\r?\n([\s\S]*?)\r?\n---\r?\n?/);
+  if (!match) return {frontMatter: {}, body: source};
+  return {frontMatter: yaml.load(match[1]) || {}, body: source.slice(match[0].length)};
+}
+
+function headingText(raw) {
+  return raw
+    .replace(/<[^>]+>/g, '')
+    .replace(/`([^`]*)`/g, '$1')
+    .replace(/\[([^\]]*)\]\([^)]*\)/g, '$1')
+    .replace(/[*_]{1,2}([^*_]+)[*_]{1,2}/g, '$1')
+    .trim();
+}
+
+function resolveImport(source, fromFile, siteDir) {
+  if (source.startsWith('@site/')) return path.join(siteDir, source.slice('@site/'.length));
+  if (source.startsWith('.')) return path.resolve(path.dirname(fromFile), source);
+  return undefined;
+}
+
+function readOutline(filePath, {siteDir, seen, parent = null}) {
+  const source = fs.readFileSync(filePath, 'utf8');
+  const {frontMatter, body} = splitFrontMatter(source);
+  const slugger = createSlugger();
+  const partials = new Map();
+  const entries = [];
+  let title = frontMatter.title;
+  let fence = null;
+  // A partial that opens with `<CopyUrl>` documents the heading that renders it
+  let current = parent;
+
+  for (const line of body.split(/\r?\n/)) {
+    const fenceMatch = line.match(/^\s*(```+|~~~+)/);
+    if (fenceMatch) {
+      // A closing fence carries no info string, as in CommonMark
+      if (!fence) fence = fenceMatch[1];
+      else if (line.trim().startsWith(fence) && /^(`+|~+)$/.test(line.trim())) fence = null;
+      continue;
+    }
+    if (fence) continue;
+
+    const importMatch = line.match(/^import\s+(\w+)\s+from\s+['"]([^'"]+\.mdx?)['"]/);
+    if (importMatch) {
+      const resolved = resolveImport(importMatch[2], filePath, siteDir);
+      if (resolved) partials.set(importMatch[1], resolved);
+      continue;
+    }
+
+    const titleMatch = !title && line.match(/^#\s+(.*?)\s*$/);
+    if (titleMatch) {
+      title = headingText(titleMatch[1]);
+      continue;
+    }
+
+    const headingMatch = line.match(/^(#{2,4})\s+(.*?)\s*$/);
+    if (headingMatch) {
+      const explicitId = headingMatch[2].match(/\{#([^}]+)\}\s*$/);
+      const raw = explicitId ? headingMatch[2].slice(0, explicitId.index) : headingMatch[2];
+      const text = headingText(raw);
+      current = {
+        depth: headingMatch[1].length,
+        text,
+        id: explicitId ? explicitId[1] : slugger.slug(text),
+        file: filePath,
+        properties: [],
+      };
+      entries.push(current);
+      continue;
+    }
+
+    const partialMatch = line.match(/^\s*<(\w+)\s*\/>\s*$/);
+    if (partialMatch && partials.has(partialMatch[1])) {
+      const partialPath = partials.get(partialMatch[1]);
+      if (!seen.has(partialPath) && fs.existsSync(partialPath)) {
+        const nested = readOutline(partialPath, {
+          siteDir,
+          seen: new Set([...seen, partialPath]),
+          parent: current,
+        });
+        entries.push(...nested.entries);
+      }
+      current = null;
+      continue;
+    }
+
+    const copyUrl = current && !current.method && line.match(/<CopyUrl\b([^>]*)\/?>/);
+    if (copyUrl) {
+      const method = copyUrl[1].match(/method=["']([A-Za-z]+)["']/);
+      const url = copyUrl[1].match(/url=["']([^"']+)["']/);
+      current.method = method ? method[1].toUpperCase() : 'GET';
+      if (url) current.url = url[1];
+    }
+    const openApiEndpoint = current && !current.method && line.match(/<OpenApiEndpoint\b([^>]*)>/);
+    if (openApiEndpoint) {
+      const method = openApiEndpoint[1].match(/method=["']([A-Za-z]+)["']/);
+      const apiPath = openApiEndpoint[1].match(/path=["']([^"']+)["']/);
+      if (method && apiPath) {
+        current.method = method[1].toUpperCase();
+        current.url = `${DEFAULT_API_ORIGIN}${apiPath[1]}`;
+      }
+    }
+
+    if (current) {
+      for (const [, name] of line.matchAll(PROPERTY_CELL)) {
+        if (!current.properties.includes(name)) current.properties.push(name);
+      }
+    }
+  }
+
+  return {frontMatter, title, entries};
+}
+
+/** Route a doc is served at: its `slug` front matter, else its file path */
+function routeOf(filePath, docsDir) {
+  const relative = path.relative(docsDir, filePath).split(path.sep).join('/');
+  const {slug} = splitFrontMatter(fs.readFileSync(filePath, 'utf8')).frontMatter;
+  let route;
+  if (slug) {
+    route = slug.startsWith('/') ? slug : path.posix.join('/', path.posix.dirname(relative), slug);
+  } else {
+    route = `/${relative.replace(/\.mdx?$/, '').replace(/(^|\/)index$/, '')}`;
+  }
+  return route.replace(/\/+$/, '') || '/';
+}
+
+const routeIndexes = new Map();
+
+function routeIndex(docsDir) {
+  if (!routeIndexes.has(docsDir)) {
+    const index = new Map();
+    const visit = (dir) => {
+      for (const entry of fs.readdirSync(dir, {withFileTypes: true})) {
+        // `_`-prefixed files and directories are not routed
+        if (entry.name.startsWith('_')) continue;
+        const entryPath = path.join(dir, entry.name);
+        if (entry.isDirectory()) visit(entryPath);
+        else if (/\.mdx?$/.test(entry.name)) index.set(routeOf(entryPath, docsDir), entryPath);
+      }
+    };
+    visit(docsDir);
+    routeIndexes.set(docsDir, index);
+  }
+  return routeIndexes.get(docsDir);
+}
+
+const outlineCache = new Map();
+
+/**
+ * Outline of the doc served at `route` (e.g. `/guidelines/finance-api`).
+ * Returns `{frontMatter, title, entries}`: the parsed front matter, the page
+ * title and the headings in document order.
+ */
+function routeOutline(route, {docsDir = DEFAULT_DOCS_DIR} = {}) {
+  const filePath = docFile(route, {docsDir});
+  if (!filePath) {
+    throw new Error(`Sidebar links to "${route}" but no doc in ${docsDir} is served at that route.`);
+  }
+  if (!outlineCache.has(filePath)) {
+    const siteDir = path.dirname(docsDir);
+    outlineCache.set(filePath, readOutline(filePath, {siteDir, seen: new Set([filePath])}));
+  }
+  return outlineCache.get(filePath);
+}
+
+/** Source file of the doc served at `route`, if any */
+function docFile(route, {docsDir = DEFAULT_DOCS_DIR} = {}) {
+  return routeIndex(docsDir).get(route.replace(/\/+$/, '') || '/');
+}
+
+/** Routes of every doc, sorted */
+function docRoutes({docsDir = DEFAULT_DOCS_DIR} = {}) {
+  return [...routeIndex(docsDir).keys()].sort();
+}
+
+module.exports = {
+  DEFAULT_DOCS_DIR,
+  docFile,
+  docRoutes,
+  routeOutline,
+};
@@ -0,0 +1,35 @@
+/**
+ * Docusaurus plugin that keeps webpack's persistent cache correct for this
+ * site, so CI can restore `node_modules/.cache` and only recompile the docs
+ * that changed.
+ *
+ * Docusaurus already gives webpack a filesystem cache invalidated by its
+ * config and version. The code of our remark plugins is added as a build
+ * dependency: when it changes, the cache starts over. The files they read
+ * (the OpenAPI specs, generated image variants) are not: CI regenerates
+ * them on every run. ./loader makes each one a dependency of the pages that
+ * read it instead, so changing a spec only recompiles the pages built from
+ * it.
+ */
+
+const fs = require('fs');
+const path = require('path');
+
+module.exports = function webpackCachePlugin(context) {
+  const {siteDir} = context;
+  const dependencies = [
+    // Remark plugins and their helpers; a trailing slash tracks a directory
+    `${path.join(siteDir, 'plugins')}/`,
+  ].filter((dependency) => fs.existsSync(dependency));
+
+  return {
+    name: 'webpack-cache',
+
+    configureWebpack(config) {
+      // `post`: runs once the MDX loader, and so the remark plugins, are done
+      const rules = [{test: /\.mdx?$/i, enforce: 'post', use: [require.resolve('./loader')]}];
+      if (!config.cache || config.cache.type !== 'filesystem') return {module: {rules}};
+      return {cache: {buildDependencies: {remark: dependencies}}, module: {rules}};
+    },
+  };
+};
@@ -0,0 +1,17 @@
+/**
+ * Runs after the MDX loader: adds the files the remark plugins read for the
+ * page (see plugins/lib/module-dependencies) to the module's dependencies.
+ * Files that don't exist yet (image variants not generated) are missing
+ * dependencies, so generating them rebuilds the page too.
+ */
+
+const fs = require('fs');
+const {dependenciesOf} = require('../lib/module-dependencies');
+
+module.exports = function remarkDependenciesLoader(source, map, meta) {
+  for (const dependency of dependenciesOf(this.resourcePath)) {
+    if (fs.existsSync(dependency)) this.addDependency(dependency);
+    else this.addMissingDependency(dependency);
+  }
+  this.callback(null, source, map, meta);
+};
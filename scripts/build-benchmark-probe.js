@@ -0,0 +1,24 @@
+/**
+ * Preloaded (`node --require`) into every Node process of a benchmarked
+ * build by scripts/build-benchmark.js: on exit, writes the process's peak
+ * RSS to $BUILD_BENCHMARK_PROBE_DIR/<pid>.json. Worker threads share their
+ * process's RSS, so one file per process covers them.
+ */
+
+const fs = require('fs');
+const path = require('path');
+
+const dir = process.env.BUILD_BENCHMARK_PROBE_DIR;
+
+if (dir) {
+  process.on('exit', () => {
+    try {
+      fs.writeFileSync(
+        path.join(dir, `${process.pid}.json`),
+        JSON.stringify({argv: process.argv.slice(1, 3), maxRssBytes: process.resourceUsage().maxRSS * 1024}),
+      );
+    } catch {
+      // Never fail the build over a measurement
+    }
+  });
+}
@@ -0,0 +1,271 @@
+#!/usr/bin/env node
+/**
+ * Benchmarks `docusaurus build` and appends the result to a history file.
+ *
+ * Two builds are measured: a cold one after `docusaurus clear` (no webpack
+ * cache) and a warm one right after it, reusing the cache. For each:
+ * - `wallMs`: wall time of the build command
+ * - `peakRssBytes`: peak RSS of the largest Node process of the build
+ *   (scripts/build-benchmark-probe.js)
+ * - `phases` and `plugins`: Docusaurus' own timings (DOCUSAURUS_PERF_LOGGER),
+ *   the top-level build phases and the time spent in the lifecycles of the
+ *   plugins listed in PLUGINS
+ *
+ * plus the size of ./build (`output`). With `--history`, the result is
+ * compared to the median of the last entries of that history: metrics
+ * over their threshold are flagged (GitHub annotations and
+ * $GITHUB_STEP_SUMMARY), and fail the run with `--fail-on-regression`.
+ *
+ *   node scripts/build-benchmark.js [--history history.json] [--output build-benchmark.json]
+ *                                   [--runs cold,warm] [--fail-on-regression]
+ */
+
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+const {spawn, execFileSync} = require('child_process');
+const {parseArgs} = require('util');
+
+const SITE_DIR = path.resolve(__dirname, '..');
+const DOCUSAURUS = path.join(SITE_DIR, 'node_modules/@docusaurus/core/bin/docusaurus.mjs');
+const PROBE = path.join(__dirname, 'build-benchmark-probe.js');
+// Entries of the history kept, and compared against
+const HISTORY_LENGTH = 100;
+const BASELINE_ENTRIES = 5;
+// Allowed growth over the baseline median, per metric
+const THRESHOLDS = {
+  'cold.wallMs': 0.2,
+  'warm.wallMs': 0.25,
+  'cold.peakRssBytes': 0.15,
+  'warm.peakRssBytes': 0.15,
+  'output.bytes': 0.1,
+};
+// Plugins whose timings are reported, matched against the perf labels
+const PLUGINS = {
+  docs: /docusaurus-plugin-content-docs/,
+  sitemap: /docusaurus-plugin-sitemap/,
+  'client-redirects': /docusaurus-plugin-client-redirects|\bredirects\b/,
+  search: /\blocal-search\b/,
+};
+
+const {values: options} = parseArgs({
+  options: {
+    history: {type: 'string'},
+    output: {type: 'string', default: 'build-benchmark.json'},
+    runs: {type: 'string', default: 'cold,warm'},
+    'fail-on-regression': {type: 'boolean', default: false},
+  },
+});
+
+const seconds = (ms) => `${(ms / 1000).toFixed(1)} s`;
+const mib = (bytes) => `${(bytes / 1024 / 1024).toFixed(1)} MiB`;
+const FORMAT = {wallMs: seconds, peakRssBytes: mib, bytes: mib};
+
+const ANSI = /\u001b\[[0-9;]*m/g;
+const PERF_LINE = /\[PERF\]\s+(.+?)\s+-\s+([\d.]+)\s*(ms|s|seconds?)\b/;
+
+/** `{label, ms}` of each Docusaurus perf log line in `output` */
+function perfEntries(output) {
+  const entries = [];
+  for (const line of output.replace(ANSI, '').split('\n')) {
+    const match = line.match(PERF_LINE);
+    if (!match) continue;
+    const value = Number(match[2]);
+    entries.push({label: match[1], ms: match[3] === 'ms' ? value : value * 1000});
+  }
+  return entries;
+}
+
+/** Time per plugin: the innermost perf entries naming it, so nested timings aren't counted twice */
+function pluginTimings(entries) {
+  const labels = entries.map((entry) => entry.label);
+  const leaves = entries.filter(
+    ({label}) => !labels.some((other) => other !== label && other.startsWith(`${label} > `)),
+  );
+  const timings = {};
+  for (const [name, pattern] of Object.entries(PLUGINS)) {
+    const matching = leaves.filter(({label}) => pattern.test(label));
+    if (matching.length) timings[name] = Math.round(matching.reduce((sum, entry) => sum + entry.ms, 0));
+  }
+  return timings;
+}
+
+/** Top-level build phases (load site, bundling, SSG, postBuild, ...) */
+function phaseTimings(entries) {
+  const phases = {};
+  for (const {label, ms} of entries) {
+    const depth = label.split(' > ').length;
+    if (depth <= 2) phases[label] = Math.round(ms);
+  }
+  return phases;
+}
+
+function runBuild(probeDir) {
+  return new Promise((resolve, reject) => {
+    const started = process.hrtime.bigint();
+    const child = spawn(process.execPath, [DOCUSAURUS, 'build'], {
+      cwd: SITE_DIR,
+      env: {
+        ...process.env,
+        DOCUSAURUS_PERF_LOGGER: 'true',
+        BUILD_BENCHMARK_PROBE_DIR: probeDir,
+        NODE_OPTIONS: [process.env.NODE_OPTIONS, `--require ${JSON.stringify(PROBE)}`].filter(Boolean).join(' '),
+      },
+      stdio: ['ignore', 'pipe', 'pipe'],
+    });
+    let output = '';
+    for (const stream of [child.stdout, child.stderr]) {
+      stream.on('data', (chunk) => {
+        output += chunk;
+        process.stdout.write(chunk);
+      });
+    }
+    child.on('error', reject);
+    child.on('close', (code) => {
+      const wallMs = Number(process.hrtime.bigint() - started) / 1e6;
+      if (code !== 0) reject(new Error(`docusaurus build exited with ${code}`));
+      else resolve({wallMs, output});
+    });
+  });
+}
+
+async function measure(kind) {
+  if (kind === 'cold') {
+    execFileSync(process.execPath, [DOCUSAURUS, 'clear'], {cwd: SITE_DIR, stdio: 'inherit'});
+  }
+  const probeDir = fs.mkdtempSync(path.join(os.tmpdir(), 'build-benchmark-'));
+  try {
+    console.log(`\n⏱  ${kind} build`);
+    const {wallMs, output} = await runBuild(probeDir);
+    const peakRssBytes = Math.max(
+      0,
+      ...fs.readdirSync(probeDir).map((file) => JSON.parse(fs.readFileSync(path.join(probeDir, file), 'utf8')).maxRssBytes),
+    );
+    const entries = perfEntries(output);
+    return {
+      wallMs: Math.round(wallMs),
+      peakRssBytes,
+      phases: phaseTimings(entries),
+      plugins: pluginTimings(entries),
+    };
+  } finally {
+    fs.rmSync(probeDir, {recursive: true, force: true});
+  }
+}
+
+const SIZE_BY_EXTENSION = ['html', 'js', 'css'];
+
+/** Bytes and files of the build, with the html/js/css share */
+function outputSize(buildDir) {
+  const size = {bytes: 0, files: 0, html: 0, js: 0, css: 0};
+  for (const name of fs.readdirSync(buildDir, {recursive: true})) {
+    const stat = fs.statSync(path.join(buildDir, name));
+    if (!stat.isFile()) continue;
+    size.bytes += stat.size;
+    size.files += 1;
+    const extension = path.extname(name).slice(1);
+    if (SIZE_BY_EXTENSION.includes(extension)) size[extension] += stat.size;
+  }
+  return size;
+}
+
+function git(...args) {
+  try {
+    return execFileSync('git', args, {cwd: SITE_DIR, encoding: 'utf8'}).trim();
+  } catch {
+    return undefined;
+  }
+}
+
+const metricOf = (entry, key) => key.split('.').reduce((value, part) => (value ? value[part] : undefined), entry);
+
+function median(values) {
+  const sorted = [...values].sort((a, b) => a - b);
+  const middle = Math.floor(sorted.length / 2);
+  return sorted.length % 2 ? sorted[middle] : (sorted[middle - 1] + sorted[middle]) / 2;
+}
+
+/** `{key, value, baseline, growth, regressed}` per thresholded metric */
+function compare(entry, history) {
+  const recent = history.slice(-BASELINE_ENTRIES);
+  return Object.entries(THRESHOLDS).flatMap(([key, threshold]) => {
+    const value = metricOf(entry, key);
+    const previous = recent.map((candidate) => metricOf(candidate, key)).filter((candidate) => candidate > 0);
+    if (value === undefined || !previous.length) return [];
+    const baseline = median(previous);
+    const growth = value / baseline - 1;
+    return [{key, value, baseline, growth, threshold, regressed: growth > threshold}];
+  });
+}
+
+function comparisonTable(rows) {
+  const format = (key, value) => FORMAT[key.split('.').pop()](value);
+  const lines = ['| Metric | This build | Baseline | Change |', '| --- | --- | --- | --- |'];
+  for (const row of rows) {
+    const change = `${row.growth >= 0 ? '+' : ''}${(row.growth * 100).toFixed(1)}%${row.regressed ? ' ⚠️' : ''}`;
+    lines.push(`| \`${row.key}\` | ${format(row.key, row.value)} | ${format(row.key, row.baseline)} | ${change} |`);
+  }
+  return lines.join('\n');
+}
+
+async function main() {
+  if (!fs.existsSync(DOCUSAURUS)) {
+    console.error('❌ Missing node_modules (run npm ci first).');
+    process.exit(2);
+  }
+  const runs = options.runs.split(',').map((run) => run.trim()).filter(Boolean);
+  const entry = {
+    commit: git('rev-parse', 'HEAD'),
+    ref: process.env.GITHUB_REF_NAME || git('rev-parse', '--abbrev-ref', 'HEAD'),
+    date: new Date().toISOString(),
+    node: process.version,
+    cpus: os.cpus().length,
+  };
+  for (const run of runs) entry[run] = await measure(run);
+  entry.output = outputSize(path.join(SITE_DIR, 'build'));
+
+  const history =
+    options.history && fs.existsSync(options.history)
+      ? JSON.parse(fs.readFileSync(options.history, 'utf8')).entries || []
+      : [];
+  const rows = compare(entry, history);
+  fs.mkdirSync(path.dirname(path.resolve(options.output)), {recursive: true});
+  fs.writeFileSync(
+    options.output,
+    `${JSON.stringify({thresholds: THRESHOLDS, entries: [...history, entry].slice(-HISTORY_LENGTH)}, null, 2)}\n`,
+  );
+
+  console.log('');
+  for (const run of runs) {
+    const {wallMs, peakRssBytes, plugins} = entry[run];
+    const pluginText = Object.entries(plugins).map(([name, ms]) => `${name} ${seconds(ms)}`).join(', ');
+    console.log(`📊 ${run}: ${seconds(wallMs)}, peak RSS ${mib(peakRssBytes)}${pluginText ? ` (${pluginText})` : ''}`);
+  }
+  console.log(`📦 output: ${mib(entry.output.bytes)} in ${entry.output.files} files`);
+
+  if (!rows.length) {
+    console.log(`   no history${options.history ? ` at ${options.history}` : ''}; nothing to compare with`);
+    return;
+  }
+  const table = comparisonTable(rows);
+  console.log('');
+  console.log(table);
+  if (process.env.GITHUB_STEP_SUMMARY) {
+    fs.appendFileSync(
+      process.env.GITHUB_STEP_SUMMARY,
+      `## Build benchmark vs. median of the last ${Math.min(history.length, BASELINE_ENTRIES)} main builds\n\n${table}\n`,
+    );
+  }
+  const regressions = rows.filter((row) => row.regressed);
+  for (const row of regressions) {
+    const message = `${row.key} grew ${(row.growth * 100).toFixed(0)}%, more than ${(row.threshold * 100).toFixed(0)}%`;
+    console.log(process.env.GITHUB_ACTIONS ? `::warning title=Build benchmark::${message}` : `⚠️  ${message}`);
+  }
+  if (regressions.length && options['fail-on-regression']) process.exit(1);
+  if (!regressions.length) console.log('✅ No build regression.');
+}
+
+main().catch((error) => {
+  console.error(`❌ ${error.message}`);
+  process.exit(1);
+});
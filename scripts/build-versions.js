@@ -0,0 +1,162 @@
+#!/usr/bin/env node
+/**
+ * Builds the frozen versions of frozen-versions.json that aren't built yet,
+ * and copies them into the site under /versions/<version>/.
+ *
+ * Each version is built once, from a git worktree of its commit, into
+ * `--prebuilt/<version>/`; CI keeps that directory in its cache, so a
+ * deploy only builds the versions frozen since the last one and the build
+ * time doesn't grow with the number of versions. A prebuilt version is
+ * reused as long as it was built from the same commit.
+ *
+ * The commit's own docusaurus.config.js is used, wrapped to serve it under
+ * its baseUrl, unindexed, with a banner linking to the latest docs.
+ *
+ *   node scripts/build-versions.js [--prebuilt versions-build] [--copy-to build/versions]
+ */
+
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+const {execFileSync} = require('child_process');
+const {parseArgs} = require('util');
+
+const SITE_DIR = path.resolve(__dirname, '..');
+const VERSIONS_FILE = path.join(SITE_DIR, 'frozen-versions.json');
+const DOCUSAURUS = path.join(SITE_DIR, 'node_modules/@docusaurus/core/bin/docusaurus.mjs');
+// Written next to a prebuilt version: the commit it was built from
+const REF_FILE = '.frozen-ref';
+const WRAPPER_CONFIG = 'docusaurus.frozen.config.js';
+
+const {values: options} = parseArgs({
+  options: {
+    prebuilt: {type: 'string', default: path.join(SITE_DIR, 'versions-build')},
+    'copy-to': {type: 'string', default: path.join(SITE_DIR, 'build/versions')},
+  },
+});
+
+const wrapperConfig = ({version, baseUrl}) => `// Written by scripts/build-versions.js
+import siteConfig from './docusaurus.config.js';
+
+export default async function frozenConfig(...args) {
+  const config = typeof siteConfig === 'function' ? await siteConfig(...args) : siteConfig;
+  return {
+    ...config,
+    baseUrl: ${JSON.stringify(baseUrl)},
+    noIndex: true,
+    themeConfig: {
+      ...config.themeConfig,
+      announcementBar: {
+        id: 'frozen-version',
+        content: ${JSON.stringify(
+          `You are viewing version ${version} of the IQM API docs. <a href="/" target="_self">See the latest version</a>.`,
+        )},
+        isCloseable: false,
+      },
+    },
+  };
+}
+`;
+
+/**
+ * node_modules of the worktree: links to the site's packages, so the build
+ * doesn't reinstall them, but its own directory so its webpack cache
+ * (node_modules/.cache) stays separate
+ */
+function linkNodeModules(worktree) {
+  const source = path.join(SITE_DIR, 'node_modules');
+  const target = path.join(worktree, 'node_modules');
+  fs.mkdirSync(target, {recursive: true});
+  for (const name of fs.readdirSync(source)) {
+    if (name !== '.cache') fs.symlinkSync(path.join(source, name), path.join(target, name));
+  }
+}
+
+function sameLockfile(worktree) {
+  const read = (dir) => fs.readFileSync(path.join(dir, 'package-lock.json'), 'utf8');
+  try {
+    return read(worktree) === read(SITE_DIR);
+  } catch {
+    return false;
+  }
+}
+
+function buildVersion({version, ref}, outDir) {
+  const worktree = fs.mkdtempSync(path.join(os.tmpdir(), `docs-${version}-`));
+  execFileSync('git', ['worktree', 'add', '--detach', worktree, ref], {cwd: SITE_DIR, stdio: 'inherit'});
+  try {
+    if (sameLockfile(worktree)) {
+      linkNodeModules(worktree);
+    } else {
+      console.log(`   dependencies differ from the current ones; installing them for ${version}`);
+      execFileSync('npm', ['ci', '--no-audit', '--no-fund'], {cwd: worktree, stdio: 'inherit'});
+    }
+    const baseUrl = `/versions/${version}/`;
+    fs.writeFileSync(path.join(worktree, WRAPPER_CONFIG), wrapperConfig({version, baseUrl}));
+    const docusaurus = fs.existsSync(path.join(worktree, 'node_modules/@docusaurus/core/bin/docusaurus.mjs'))
+      ? path.join(worktree, 'node_modules/@docusaurus/core/bin/docusaurus.mjs')
+      : DOCUSAURUS;
+    fs.rmSync(outDir, {recursive: true, force: true});
+    execFileSync(process.execPath, [docusaurus, 'build', '--config', WRAPPER_CONFIG, '--out-dir', outDir], {
+      cwd: worktree,
+      stdio: 'inherit',
+      // Legacy URL stubs belong to the latest docs only
+      env: {...process.env, DOCS_VERSION: version, REDIRECT_STUBS: 'false'},
+    });
+    fs.writeFileSync(path.join(outDir, REF_FILE), `${ref}\n`);
+  } finally {
+    execFileSync('git', ['worktree', 'remove', '--force', worktree], {cwd: SITE_DIR, stdio: 'inherit'});
+  }
+}
+
+function prebuiltRef(outDir) {
+  try {
+    return fs.readFileSync(path.join(outDir, REF_FILE), 'utf8').trim();
+  } catch {
+    return undefined;
+  }
+}
+
+function main() {
+  const versions = JSON.parse(fs.readFileSync(VERSIONS_FILE, 'utf8'));
+  const prebuiltDir = path.resolve(options.prebuilt);
+  const copyTo = path.resolve(options['copy-to']);
+  fs.mkdirSync(prebuiltDir, {recursive: true});
+  if (!versions.length) {
+    console.log('No frozen version in frozen-versions.json.');
+    return;
+  }
+  if (!fs.existsSync(DOCUSAURUS)) {
+    console.error('❌ Missing node_modules (run npm ci first).');
+    process.exit(2);
+  }
+
+  // Versions no longer listed would stay in the cache forever
+  const listed = new Set(versions.map((entry) => entry.version));
+  for (const name of fs.readdirSync(prebuiltDir)) {
+    if (!listed.has(name)) fs.rmSync(path.join(prebuiltDir, name), {recursive: true, force: true});
+  }
+
+  let built = 0;
+  for (const entry of versions) {
+    const outDir = path.join(prebuiltDir, entry.version);
+    if (prebuiltRef(outDir) === entry.ref) {
+      console.log(`📦 ${entry.version}: prebuilt at ${entry.ref.slice(0, 12)}`);
+    } else {
+      console.log(`🔨 ${entry.version}: building ${entry.ref.slice(0, 12)}`);
+      buildVersion(entry, outDir);
+      built += 1;
+    }
+    const target = path.join(copyTo, entry.version);
+    fs.rmSync(target, {recursive: true, force: true});
+    fs.cpSync(outDir, target, {recursive: true, filter: (source) => path.basename(source) !== REF_FILE});
+  }
+  console.log(`✅ ${versions.length} frozen versions in ${path.relative(SITE_DIR, copyTo)} (${built} built)`);
+}
+
+try {
+  main();
+} catch (error) {
+  console.error(`❌ ${error.message}`);
+  process.exit(1);
+}
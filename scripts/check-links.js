@@ -0,0 +1,379 @@
+#!/usr/bin/env node
+/**
+ * Checks every link in the built site (./build) in a single pass:
+ *
+ * - links within the site are resolved against the build output on disk, so
+ *   no local server or crawl is needed
+ * - external links are requested with bounded concurrency, at most
+ *   `--per-host` requests at a time and one every `--interval` ms per host
+ * - help.iqm.com answers 200 for missing articles, so its pages are fetched
+ *   and their body checked for "not found" wording (soft 404s)
+ *
+ * Results are cached in node_modules/.cache/link-check/ (restored in CI
+ * with the build cache). Links that were fine less than `--max-age` hours
+ * ago are not requested again; older ones are revalidated with their
+ * ETag/Last-Modified, and a 304 keeps the previous result.
+ *
+ * The report (`--report`, default link-report.json) is written as results
+ * come in: `{"links": [{url, state, status, parents, ...}, ...]}`.
+ *
+ * Exits with 1 when a link is broken.
+ *
+ *   node scripts/check-links.js [--build build] [--report link-report.json]
+ */
+
+const fs = require('fs');
+const path = require('path');
+const {parseArgs} = require('util');
+
+const SITE_URL = 'https://developers.iqm.com/';
+const USER_AGENT = 'IQM-Link-Check/2.0';
+const SKIP = /^(mailto:|tel:|#|javascript:|about:blank|data:)|localhost|127\.0\.0\.1/;
+// Links not checked, matched against the absolute URL (decoded too):
+// hosts that block automated requests, the hashed spec download, and the
+// legacy mixed-case paths served by the redirects of the deployed site
+const SKIP_URLS = [
+  /^https?:\/\/(www\.)?iab\.com\//,
+  /^https:\/\/www\.coupa\.com\//,
+  /^https:\/\/github\.com\/iqmcorp\/docs\/discussions/,
+  /^https?:\/\/(www\.)?tableau\.com\//,
+  /^https?:\/\/(www\.)?zapier\.com\//,
+  /^https?:\/\/(www\.)?make\.com\//,
+  /^https:\/\/api-docs\.freewheel\.tv\/beeswax\/v2\.0\/reference\/(retrieveexpression|listexpressions|createexpression|updateexpression)$/,
+  /^https:\/\/www\.tapclicks\.com\/resources\/connectors\/iqm-reports\//,
+  /assets\/files\/openapi-[a-f0-9]{32}\.json\/?$/,
+  /Authentication-Quickstart-Guide/,
+  /Reporting-API-Quickstart-Guide/,
+  /Schedule-Report-API-Quickstart-Guide/,
+  /Customer-Guide/,
+  /Upload-a-Matched-Audience/,
+  /Optimize-Your-Inventory/,
+  /political-vertical\/(Audience-Segments|Finance)/,
+  /healthcare-vertical\/(Audience-Healthcare|Finance|Insights-PLD)/,
+  /migration-guides\/(Beeswax|The Trade Desk|DV360|Xandr)\/Overview/,
+];
+// Resource hints point at origins, not documents
+const SKIP_REL = /\b(preconnect|dns-prefetch)\b/;
+const SOFT_404_HOSTS = new Set(['help.iqm.com']);
+// Add/edit patterns as you learn the help center's phrasing
+const SOFT_404 =
+  /(page not found|article not found|not[\s-]*found|doesn.t exist|we couldn.t find|404[^0-9])/i;
+const LINK_TAG = /<(a|link|img|script|source|iframe)\b([^>]*)>/gi;
+const MAX_RETRY_AFTER_MS = 30000;
+
+const {values: options} = parseArgs({
+  options: {
+    build: {type: 'string', default: 'build'},
+    report: {type: 'string', default: 'link-report.json'},
+    cache: {type: 'string', default: 'node_modules/.cache/link-check/results.json'},
+    concurrency: {type: 'string', default: '16'},
+    'per-host': {type: 'string', default: '2'},
+    interval: {type: 'string', default: '250'},
+    timeout: {type: 'string', default: '25000'},
+    'max-age': {type: 'string', default: '24'},
+  },
+});
+
+const decodeEntities = (value) =>
+  value
+    .replace(/&amp;/g, '&')
+    .replace(/&quot;/g, '"')
+    .replace(/&#x27;|&#39;/g, "'")
+    .replace(/&lt;/g, '<')
+    .replace(/&gt;/g, '>');
+
+function attributeOf(attributes, name) {
+  const match = attributes.match(new RegExp(`\\s${name}=(?:"([^"]*)"|'([^']*)'|([^\\s>]+))`, 'i'));
+  return match ? decodeEntities(match[1] ?? match[2] ?? match[3]) : undefined;
+}
+
+/** Page URL (e.g. `/guidelines/finance-api/`) of an HTML file in the build */
+function pageUrl(relative) {
+  const posix = relative.split(path.sep).join('/');
+  return new URL(posix.replace(/(^|\/)index\.html$/, '$1'), SITE_URL);
+}
+
+/** URL -> pages linking to it, for every link in the build */
+function collectLinks(buildDir) {
+  const links = new Map();
+  const pages = fs
+    .readdirSync(buildDir, {recursive: true})
+    .filter((name) => name.endsWith('.html'))
+    .sort();
+  for (const page of pages) {
+    const html = fs.readFileSync(path.join(buildDir, page), 'utf8');
+    const base = pageUrl(page);
+    for (const [, tag, attributes] of html.matchAll(LINK_TAG)) {
+      if (tag.toLowerCase() === 'link' && SKIP_REL.test(attributeOf(attributes, 'rel') || '')) continue;
+      const value = attributeOf(attributes, 'href') ?? attributeOf(attributes, 'src');
+      if (!value || SKIP.test(value)) continue;
+      let url;
+      try {
+        url = new URL(value, base);
+      } catch {
+        continue;
+      }
+      if (!/^https?:$/.test(url.protocol)) continue;
+      url.hash = '';
+      const key = url.href;
+      if (!links.has(key)) links.set(key, new Set());
+      links.get(key).add(base.pathname);
+    }
+  }
+  return {links, pageCount: pages.length};
+}
+
+function isSkipped(url) {
+  let decoded = url;
+  try {
+    decoded = decodeURI(url);
+  } catch {
+    // Keep the encoded form
+  }
+  return SKIP_URLS.some((pattern) => pattern.test(url) || pattern.test(decoded));
+}
+
+/** Whether a URL on the site resolves to a file in the build */
+function existsInBuild(buildDir, url) {
+  let pathname;
+  try {
+    pathname = decodeURIComponent(url.pathname);
+  } catch {
+    return false;
+  }
+  const filePath = path.join(buildDir, pathname);
+  const candidates = pathname.endsWith('/')
+    ? [path.join(filePath, 'index.html')]
+    : [filePath, path.join(filePath, 'index.html'), `${filePath}.html`];
+  return candidates.some((candidate) => fs.existsSync(candidate) && fs.statSync(candidate).isFile());
+}
+
+/**
+ * Runs tasks at most `limit` at a time, starting one at most every
+ * `interval` ms
+ */
+function createLimiter(limit, interval = 0) {
+  const waiting = [];
+  let active = 0;
+  let lastStart = 0;
+  let timer = null;
+  const next = () => {
+    if (timer || active >= limit || !waiting.length) return;
+    const wait = lastStart + interval - Date.now();
+    if (wait > 0) {
+      timer = setTimeout(() => {
+        timer = null;
+        next();
+      }, wait);
+      return;
+    }
+    active += 1;
+    lastStart = Date.now();
+    waiting.shift()();
+    next();
+  };
+  return async (task) => {
+    await new Promise((resolve) => {
+      waiting.push(resolve);
+      next();
+    });
+    try {
+      return await task();
+    } finally {
+      active -= 1;
+      next();
+    }
+  };
+}
+
+function readCache(cachePath) {
+  try {
+    return JSON.parse(fs.readFileSync(cachePath, 'utf8'));
+  } catch {
+    return {};
+  }
+}
+
+function writeCache(cachePath, cache) {
+  fs.mkdirSync(path.dirname(cachePath), {recursive: true});
+  fs.writeFileSync(cachePath, JSON.stringify(cache));
+}
+
+const sleep = (ms) => new Promise((resolve) => setTimeout(resolve, ms));
+
+async function request(url, method, headers, timeout) {
+  return fetch(url, {
+    method,
+    redirect: 'follow',
+    headers: {'user-agent': USER_AGENT, ...headers},
+    signal: AbortSignal.timeout(timeout),
+  });
+}
+
+/** Requests an external URL, revalidating `cached` when it has validators */
+async function checkExternal(url, cached, timeout) {
+  const needsBody = SOFT_404_HOSTS.has(new URL(url).hostname);
+  const headers = {};
+  if (cached && cached.state === 'OK') {
+    if (cached.etag) headers['if-none-match'] = cached.etag;
+    if (cached.lastModified) headers['if-modified-since'] = cached.lastModified;
+  }
+
+  let response = await request(url, needsBody ? 'GET' : 'HEAD', headers, timeout);
+  // Plenty of servers answer HEAD differently from GET
+  if (!needsBody && response.status >= 400 && response.status !== 429) {
+    response = await request(url, 'GET', headers, timeout);
+  }
+  if (response.status === 429) {
+    const retryAfter = Math.min(Number(response.headers.get('retry-after')) * 1000 || 5000, MAX_RETRY_AFTER_MS);
+    await sleep(retryAfter);
+    response = await request(url, needsBody ? 'GET' : 'HEAD', headers, timeout);
+  }
+
+  if (response.status === 304 && cached) {
+    await response.body?.cancel();
+    return {...cached, revalidated: true};
+  }
+
+  const result = {
+    status: response.status,
+    etag: response.headers.get('etag') || undefined,
+    lastModified: response.headers.get('last-modified') || undefined,
+  };
+  if (response.status === 429) {
+    await response.body?.cancel();
+    return {...result, state: 'SKIPPED', reason: 'rate limited'};
+  }
+  if (response.status >= 400) {
+    await response.body?.cancel();
+    return {...result, state: 'BROKEN'};
+  }
+  if (needsBody && SOFT_404.test(await response.text())) {
+    return {...result, state: 'BROKEN', reason: 'soft 404'};
+  }
+  await response.body?.cancel();
+  return {...result, state: 'OK'};
+}
+
+/** Writes `{"links": [...]}` one entry at a time */
+function createReport(reportPath) {
+  const stream = fs.createWriteStream(reportPath);
+  let first = true;
+  stream.write('{"links":[\n');
+  return {
+    add(entry) {
+      stream.write(`${first ? '' : ',\n'}${JSON.stringify(entry)}`);
+      first = false;
+    },
+    close() {
+      return new Promise((resolve, reject) => {
+        stream.on('error', reject);
+        stream.end('\n]}\n', resolve);
+      });
+    },
+  };
+}
+
+async function main() {
+  const buildDir = path.resolve(options.build);
+  if (!fs.existsSync(buildDir)) {
+    console.error(`❌ Missing ${options.build} (run npm run build first).`);
+    process.exit(2);
+  }
+  const timeout = Number(options.timeout);
+  const maxAgeMs = Number(options['max-age']) * 60 * 60 * 1000;
+  const siteOrigin = new URL(SITE_URL).origin;
+
+  const {links, pageCount} = collectLinks(buildDir);
+  const cache = readCache(options.cache);
+  const report = createReport(options.report);
+  const limitAll = createLimiter(Number(options.concurrency));
+  const hostLimiters = new Map();
+  const limitHost = (host) => {
+    if (!hostLimiters.has(host)) {
+      hostLimiters.set(host, createLimiter(Number(options['per-host']), Number(options.interval)));
+    }
+    return hostLimiters.get(host);
+  };
+
+  const counts = {OK: 0, BROKEN: 0, SKIPPED: 0, requested: 0, cached: 0};
+  const broken = [];
+  const record = (url, result) => {
+    const entry = {url, ...result, parents: [...links.get(url)]};
+    counts[entry.state] += 1;
+    if (entry.state === 'BROKEN') broken.push(entry);
+    report.add(entry);
+  };
+
+  const external = [];
+  for (const url of links.keys()) {
+    const parsed = new URL(url);
+    if (isSkipped(url)) {
+      record(url, {state: 'SKIPPED', reason: 'skip list'});
+    } else if (parsed.origin === siteOrigin) {
+      const found = existsInBuild(buildDir, parsed);
+      record(url, found ? {state: 'OK', internal: true} : {state: 'BROKEN', status: 404, internal: true});
+    } else {
+      external.push(url);
+    }
+  }
+
+  console.log(`🔎 Checking ${links.size} links from ${pageCount} pages (${external.length} external)...`);
+  const started = Date.now();
+
+  await Promise.all(
+    external.map((url) =>
+      limitHost(new URL(url).host)(() =>
+        limitAll(async () => {
+          const cached = cache[url];
+          if (cached && cached.state === 'OK' && Date.now() - cached.checkedAt < maxAgeMs) {
+            counts.cached += 1;
+            record(url, {state: cached.state, status: cached.status, cached: true});
+            return;
+          }
+          counts.requested += 1;
+          let result;
+          try {
+            result = await checkExternal(url, cached, timeout);
+          } catch (error) {
+            result = {state: 'BROKEN', status: 0, reason: error.cause?.code || error.name || String(error)};
+          }
+          const {revalidated, ...stored} = result;
+          if (result.state !== 'SKIPPED') cache[url] = {...stored, checkedAt: Date.now()};
+          if (revalidated) counts.cached += 1;
+          record(url, {
+            state: result.state,
+            status: result.status,
+            ...(result.reason && {reason: result.reason}),
+            ...(revalidated && {cached: true}),
+          });
+        }),
+      ),
+    ),
+  );
+
+  await report.close();
+  writeCache(options.cache, cache);
+
+  const seconds = ((Date.now() - started) / 1000).toFixed(1);
+  console.log(
+    `   ${counts.OK} ok, ${counts.BROKEN} broken, ${counts.SKIPPED} skipped; ` +
+      `${counts.requested} requested, ${counts.cached} answered from cache (${seconds}s)`,
+  );
+  if (broken.length) {
+    console.log('');
+    console.log('=== Broken links ===');
+    for (const entry of broken) {
+      const reason = entry.reason ? ` ${entry.reason}` : '';
+      console.log(`❌ [${entry.status}${reason}] ${entry.url}`);
+      console.log(`   linked from ${entry.parents.slice(0, 3).join(', ')}${entry.parents.length > 3 ? ', ...' : ''}`);
+    }
+    process.exit(1);
+  }
+  console.log('✅ No broken links.');
+}
+
+main().catch((error) => {
+  console.error(error);
+  process.exit(2);
+});
@@ -0,0 +1,56 @@
+#!/usr/bin/env node
+/**
+ * Freezes a version of the docs: adds it to frozen-versions.json with the
+ * commit it is built from. The version is then served under
+ * /versions/<version>/, with the OpenAPI specifications of that commit
+ * (/versions/<version>/openapi/openapi.json, ...), and its build is made
+ * once and reused (scripts/build-versions.js).
+ *
+ * Freeze before a change of the API revision the docs describe, e.g. a
+ * release that changes the endpoints of a migration guide.
+ *
+ *   node scripts/freeze-version.js <version> [--ref HEAD]
+ */
+
+const fs = require('fs');
+const path = require('path');
+const {execFileSync} = require('child_process');
+const {parseArgs} = require('util');
+
+const SITE_DIR = path.resolve(__dirname, '..');
+const VERSIONS_FILE = path.join(SITE_DIR, 'frozen-versions.json');
+// Part of the URL and of a cache key
+const VERSION_NAME = /^\w[\w.-]*$/;
+
+const {values: options, positionals} = parseArgs({
+  allowPositionals: true,
+  options: {
+    ref: {type: 'string', default: 'HEAD'},
+  },
+});
+
+const [version] = positionals;
+if (!version || !VERSION_NAME.test(version)) {
+  console.error('Usage: node scripts/freeze-version.js <version> [--ref HEAD]');
+  console.error('   the version is made of letters, digits, ".", "-" and "_", e.g. 2026-10');
+  process.exit(2);
+}
+
+const versions = JSON.parse(fs.readFileSync(VERSIONS_FILE, 'utf8'));
+if (versions.some((entry) => entry.version === version)) {
+  console.error(`❌ ${version} is already frozen.`);
+  process.exit(1);
+}
+
+const ref = execFileSync('git', ['rev-parse', '--verify', `${options.ref}^{commit}`], {
+  cwd: SITE_DIR,
+  encoding: 'utf8',
+}).trim();
+const spec = JSON.parse(
+  execFileSync('git', ['show', `${ref}:static/openapi/openapi.json`], {cwd: SITE_DIR, encoding: 'utf8', maxBuffer: 64 * 1024 * 1024}),
+);
+
+// Newest first, the order of the navbar dropdown
+versions.unshift({version, ref, apiVersion: spec.info?.version, frozenAt: new Date().toISOString().slice(0, 10)});
+fs.writeFileSync(VERSIONS_FILE, `${JSON.stringify(versions, null, 2)}\n`);
+console.log(`✅ Froze ${version} at ${ref.slice(0, 12)}; commit frozen-versions.json to publish it.`);
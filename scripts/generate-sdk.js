@@ -0,0 +1,40 @@
+#!/usr/bin/env node
+/**
+ * Generates the per-API modules of the TypeScript SDK (sdk/) from the
+ * specifications in static/openapi: for every `mcp-<domain>.json`,
+ * `sdk/dist/<domain>.js` (one tree-shakeable export per operation) and
+ * `sdk/dist/<domain>.d.ts` (its parameter and response types).
+ *
+ * The docs samples of `<OpenApiSdkSample>` come from the same naming (see
+ * plugins/openapi/lib/sdk.js), so they always match the published package.
+ *
+ *   node scripts/generate-sdk.js [--specs static/openapi] [--output sdk/dist]
+ */
+
+const fs = require('fs');
+const path = require('path');
+const {parseArgs} = require('util');
+const {DEFAULT_SPEC_DIR, loadModules, generateModule} = require('../plugins/openapi/lib/sdk');
+
+const SITE_DIR = path.resolve(__dirname, '..');
+
+const {values: options} = parseArgs({
+  options: {
+    specs: {type: 'string', default: DEFAULT_SPEC_DIR},
+    output: {type: 'string', default: path.join(SITE_DIR, 'sdk/dist')},
+  },
+});
+
+const outputDir = path.resolve(options.output);
+fs.rmSync(outputDir, {recursive: true, force: true});
+fs.mkdirSync(outputDir, {recursive: true});
+
+let count = 0;
+for (const [domain, {spec, operations}] of loadModules(path.resolve(options.specs))) {
+  const {js, dts} = generateModule(spec, operations);
+  fs.writeFileSync(path.join(outputDir, `${domain}.js`), js);
+  fs.writeFileSync(path.join(outputDir, `${domain}.d.ts`), dts);
+  count += operations.length;
+  console.log(`${domain}: ${operations.length} operations`);
+}
+console.log(`Wrote ${count} operations to ${path.relative(SITE_DIR, outputDir)}`);
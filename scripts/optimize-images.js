@@ -0,0 +1,59 @@
+#!/usr/bin/env node
+/**
+ * Writes resized AVIF and WebP variants of every PNG/JPEG in static/img to
+ * static/img-variants/ (see plugins/images). Variants newer than their
+ * source are kept, so reruns only process changed images.
+ *
+ * requires sharp, pinned where CI installs it: npm install --no-save sharp@0.34.3
+ */
+
+const fs = require('fs');
+const path = require('path');
+const sharp = require('sharp');
+const {SOURCE_DIR, OUTPUT_DIR, FORMATS, targetWidths, variantName} = require('../plugins/images/variants');
+
+const ENCODERS = {
+  avif: (image) => image.avif({quality: 55, effort: 4}),
+  webp: (image) => image.webp({quality: 75}),
+};
+
+function isFresh(output, source) {
+  return fs.existsSync(output) && fs.statSync(output).mtimeMs >= fs.statSync(source).mtimeMs;
+}
+
+async function main() {
+  const sources = fs
+    .readdirSync(SOURCE_DIR, {recursive: true})
+    .filter((name) => /\.(png|jpe?g)$/i.test(name))
+    .map((name) => name.split(path.sep).join('/'));
+
+  let written = 0;
+  let sourceBytes = 0;
+  let variantBytes = 0;
+  for (const relative of sources) {
+    const sourcePath = path.join(SOURCE_DIR, relative);
+    const {width} = await sharp(sourcePath).metadata();
+    sourceBytes += fs.statSync(sourcePath).size;
+    for (const target of targetWidths(width)) {
+      for (const format of FORMATS) {
+        const output = path.join(OUTPUT_DIR, variantName(relative, target, format));
+        if (!isFresh(output, sourcePath)) {
+          fs.mkdirSync(path.dirname(output), {recursive: true});
+          await ENCODERS[format](sharp(sourcePath).resize({width: target})).toFile(output);
+          written += 1;
+        }
+        if (target === targetWidths(width)[0]) variantBytes += fs.statSync(output).size;
+      }
+    }
+  }
+  const mb = (bytes) => `${(bytes / 1024 / 1024).toFixed(1)} MB`;
+  console.log(
+    `${sources.length} images, ${written} variants written. ` +
+      `Originals: ${mb(sourceBytes)}; smallest AVIF+WebP variants: ${mb(variantBytes)}.`,
+  );
+}
+
+main().catch((error) => {
+  console.error(error);
+  process.exit(1);
+});
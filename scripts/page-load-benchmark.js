@@ -0,0 +1,227 @@
+#!/usr/bin/env node
+/**
+ * Loads the heaviest routes of the built site (./build, served by
+ * `docusaurus serve`) with Lighthouse under fixed CPU and network
+ * throttling, and appends the result to a history file.
+ *
+ * Per route, the median of `--runs` loads of:
+ * - `lcpMs`: Largest Contentful Paint
+ * - `tbtMs`: Total Blocking Time, mostly hydration on these pages
+ * - `domSize`: elements of the page after load
+ * - `transferBytes`: bytes transferred over the network
+ *
+ * With `--history`, each metric is compared to the median of the last
+ * entries of that history, and flagged (GitHub annotations and
+ * $GITHUB_STEP_SUMMARY) when over its threshold. For the before/after of a
+ * change, run it on both builds with the same history:
+ *
+ *   node scripts/page-load-benchmark.js --output before.json
+ *   node scripts/page-load-benchmark.js --history before.json --output after.json
+ *
+ * requires Lighthouse and Chrome: npm install --no-save lighthouse@12.6.1 chrome-launcher@1.2.0
+ *
+ *   node scripts/page-load-benchmark.js [--history history.json] [--output page-load-benchmark.json]
+ *                                       [--runs 3] [--routes /a/,/b/] [--fail-on-regression]
+ */
+
+const fs = require('fs');
+const path = require('path');
+const {spawn, execFileSync} = require('child_process');
+const {parseArgs} = require('util');
+
+const SITE_DIR = path.resolve(__dirname, '..');
+const DOCUSAURUS = path.join(SITE_DIR, 'node_modules/@docusaurus/core/bin/docusaurus.mjs');
+const PORT = 3210;
+// The largest API references, the verticals built from the most partials,
+// and the partnership page with the most screenshots
+const ROUTES = [
+  '/guidelines/campaign-api/',
+  '/guidelines/inventory-api/',
+  '/guidelines/workspace-api/',
+  '/healthcare-vertical/audience-healthcare/',
+  '/political-vertical/audience-segments/',
+  '/partnerships/hubspot/',
+];
+// Lighthouse's mobile preset, fixed here so that a Lighthouse upgrade
+// doesn't move the numbers: slow 4G and a 4x slower CPU, simulated from
+// an unthrottled load so that runs on a shared CI machine stay comparable
+const THROTTLING = {rttMs: 150, throughputKbps: 1638.4, cpuSlowdownMultiplier: 4};
+const HISTORY_LENGTH = 100;
+const BASELINE_ENTRIES = 5;
+// Allowed growth over the baseline median, per metric
+const THRESHOLDS = {lcpMs: 0.15, tbtMs: 0.25, domSize: 0.05, transferBytes: 0.05};
+const AUDITS = {
+  lcpMs: 'largest-contentful-paint',
+  tbtMs: 'total-blocking-time',
+  domSize: 'dom-size',
+  transferBytes: 'total-byte-weight',
+};
+
+const {values: options} = parseArgs({
+  options: {
+    history: {type: 'string'},
+    output: {type: 'string', default: 'page-load-benchmark.json'},
+    runs: {type: 'string', default: '3'},
+    routes: {type: 'string'},
+    'fail-on-regression': {type: 'boolean', default: false},
+  },
+});
+
+const milliseconds = (ms) => `${Math.round(ms)} ms`;
+const kib = (bytes) => `${(bytes / 1024).toFixed(1)} KiB`;
+const FORMAT = {lcpMs: milliseconds, tbtMs: milliseconds, domSize: String, transferBytes: kib};
+
+function median(values) {
+  const sorted = [...values].sort((a, b) => a - b);
+  const middle = Math.floor(sorted.length / 2);
+  return sorted.length % 2 ? sorted[middle] : (sorted[middle - 1] + sorted[middle]) / 2;
+}
+
+function git(...args) {
+  try {
+    return execFileSync('git', args, {cwd: SITE_DIR, encoding: 'utf8'}).trim();
+  } catch {
+    return undefined;
+  }
+}
+
+/** Serves ./build and resolves once it answers */
+async function serve() {
+  const server = spawn(process.execPath, [DOCUSAURUS, 'serve', '--port', String(PORT), '--host', '127.0.0.1', '--no-open'], {
+    cwd: SITE_DIR,
+    stdio: 'ignore',
+  });
+  const origin = `http://127.0.0.1:${PORT}`;
+  for (let attempt = 0; attempt < 60; attempt += 1) {
+    try {
+      if ((await fetch(origin)).ok) return {origin, server};
+    } catch {
+      // Not listening yet
+    }
+    await new Promise((resolve) => setTimeout(resolve, 500));
+  }
+  server.kill();
+  throw new Error(`docusaurus serve did not answer on ${origin}`);
+}
+
+async function loadRoute(lighthouse, port, url) {
+  const result = await lighthouse(
+    url,
+    {port, output: 'json', logLevel: 'error', onlyCategories: ['performance']},
+    {
+      extends: 'lighthouse:default',
+      settings: {formFactor: 'mobile', throttlingMethod: 'simulate', throttling: THROTTLING},
+    },
+  );
+  const {audits, runtimeError} = result.lhr;
+  if (runtimeError) throw new Error(`${url}: ${runtimeError.message}`);
+  return Object.fromEntries(Object.entries(AUDITS).map(([metric, audit]) => [metric, audits[audit].numericValue]));
+}
+
+/** `{route, metric, value, baseline, growth, regressed}` per route and metric */
+function compare(entry, history) {
+  const recent = history.slice(-BASELINE_ENTRIES);
+  return Object.entries(entry.routes).flatMap(([route, metrics]) =>
+    Object.entries(THRESHOLDS).flatMap(([metric, threshold]) => {
+      const value = metrics[metric];
+      const previous = recent.map((candidate) => candidate.routes?.[route]?.[metric]).filter((candidate) => candidate > 0);
+      if (value === undefined || !previous.length) return [];
+      const baseline = median(previous);
+      const growth = value / baseline - 1;
+      return [{route, metric, value, baseline, growth, threshold, regressed: growth > threshold}];
+    }),
+  );
+}
+
+function comparisonTable(rows) {
+  const lines = ['| Route | Metric | This build | Baseline | Change |', '| --- | --- | --- | --- | --- |'];
+  for (const row of rows) {
+    const format = FORMAT[row.metric];
+    const change = `${row.growth >= 0 ? '+' : ''}${(row.growth * 100).toFixed(1)}%${row.regressed ? ' ⚠️' : ''}`;
+    lines.push(`| ${row.route} | \`${row.metric}\` | ${format(row.value)} | ${format(row.baseline)} | ${change} |`);
+  }
+  return lines.join('\n');
+}
+
+async function main() {
+  if (!fs.existsSync(DOCUSAURUS)) {
+    console.error('❌ Missing node_modules (run npm ci first).');
+    process.exit(2);
+  }
+  if (!fs.existsSync(path.join(SITE_DIR, 'build/index.html'))) {
+    console.error('❌ Missing ./build (run npm run build first).');
+    process.exit(2);
+  }
+  // Both are ES modules
+  const {default: lighthouse} = await import('lighthouse');
+  const chromeLauncher = await import('chrome-launcher');
+
+  const routes = options.routes ? options.routes.split(',').map((route) => route.trim()).filter(Boolean) : ROUTES;
+  const runs = Math.max(1, Number(options.runs) || 1);
+  const {origin, server} = await serve();
+  const chrome = await chromeLauncher.launch({chromeFlags: ['--headless=new', '--no-sandbox']});
+  const entry = {
+    commit: git('rev-parse', 'HEAD'),
+    ref: process.env.GITHUB_REF_NAME || git('rev-parse', '--abbrev-ref', 'HEAD'),
+    date: new Date().toISOString(),
+    runs,
+    routes: {},
+  };
+  try {
+    for (const route of routes) {
+      const loads = [];
+      for (let run = 0; run < runs; run += 1) loads.push(await loadRoute(lighthouse, chrome.port, `${origin}${route}`));
+      entry.routes[route] = Object.fromEntries(
+        Object.keys(AUDITS).map((metric) => [metric, Math.round(median(loads.map((load) => load[metric])))]),
+      );
+      const {lcpMs, tbtMs, domSize, transferBytes} = entry.routes[route];
+      console.log(
+        `📊 ${route}: LCP ${milliseconds(lcpMs)}, TBT ${milliseconds(tbtMs)}, ${domSize} elements, ${kib(transferBytes)}`,
+      );
+    }
+  } finally {
+    await chrome.kill();
+    server.kill();
+  }
+
+  const history =
+    options.history && fs.existsSync(options.history)
+      ? JSON.parse(fs.readFileSync(options.history, 'utf8')).entries || []
+      : [];
+  const rows = compare(entry, history);
+  fs.mkdirSync(path.dirname(path.resolve(options.output)), {recursive: true});
+  fs.writeFileSync(
+    options.output,
+    `${JSON.stringify(
+      {throttling: THROTTLING, thresholds: THRESHOLDS, entries: [...history, entry].slice(-HISTORY_LENGTH)},
+      null,
+      2,
+    )}\n`,
+  );
+
+  if (!rows.length) {
+    console.log(`   no history${options.history ? ` at ${options.history}` : ''}; nothing to compare with`);
+    return;
+  }
+  const table = comparisonTable(rows);
+  console.log('');
+  console.log(table);
+  if (process.env.GITHUB_STEP_SUMMARY) {
+    fs.appendFileSync(
+      process.env.GITHUB_STEP_SUMMARY,
+      `## Page load vs. median of the last ${Math.min(history.length, BASELINE_ENTRIES)} main builds\n\n${table}\n`,
+    );
+  }
+  const regressions = rows.filter((row) => row.regressed);
+  for (const row of regressions) {
+    const message = `${row.route} ${row.metric} grew ${(row.growth * 100).toFixed(0)}%, more than ${(row.threshold * 100).toFixed(0)}%`;
+    console.log(process.env.GITHUB_ACTIONS ? `::warning title=Page load benchmark::${message}` : `⚠️  ${message}`);
+  }
+  if (regressions.length && options['fail-on-regression']) process.exit(1);
+  if (!regressions.length) console.log('✅ No page load regression.');
+}
+
+main().catch((error) => {
+  console.error(`❌ ${error.message}`);
+  process.exit(1);
+});
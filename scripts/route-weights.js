@@ -0,0 +1,288 @@
+#!/usr/bin/env node
+/**
+ * Writes the weight of every route of the built site (./build) and checks
+ * it against route-budgets.json.
+ *
+ * Per route:
+ * - `html`, `js`, `css`: gzip bytes of the page and of the scripts and
+ *   stylesheets it loads up front (lazy chunks are not counted)
+ * - `images`: bytes of the images it references
+ * - `domNodes`: elements in the server HTML, all hydrated by React
+ * - `components`: MDX component tags in the doc source, partials included
+ *
+ * With `--baseline` (the report of the last `main` build) the largest
+ * changes are listed, and a route whose js/css/html grows by more than the
+ * budgets' `maxGrowth` (and by more than `minGrowth` KiB, so a small page
+ * isn't failed for a few hundred bytes) fails, like one that exceeds its
+ * budget. The comparison is also written to $GITHUB_STEP_SUMMARY when set.
+ * Until main has produced a baseline, the check only reports: the budgets
+ * are set from that report.
+ *
+ * `--set-budgets main.json` writes the budgets of route-budgets.json from a
+ * report instead: every route that would exceed a default budget gets its
+ * own, its weight plus the budgets' `headroom`.
+ *
+ *   node scripts/route-weights.js [--output route-weights.json] [--baseline main.json]
+ *   node scripts/route-weights.js --set-budgets route-weights-main/route-weights.json
+ */
+
+const fs = require('fs');
+const path = require('path');
+const zlib = require('zlib');
+const {parseArgs} = require('util');
+const {docFile} = require('../plugins/sidebar/outline');
+
+const SITE_DIR = path.resolve(__dirname, '..');
+const METRICS = ['html', 'js', 'css', 'images', 'domNodes', 'components'];
+// Metrics with a byte budget, in KiB
+const BUDGETED = ['html', 'js', 'css', 'images'];
+const GROWTH_CHECKED = ['html', 'js', 'css'];
+const SUMMARY_ROWS = 15;
+
+const {values: options} = parseArgs({
+  options: {
+    build: {type: 'string', default: 'build'},
+    output: {type: 'string', default: 'route-weights.json'},
+    baseline: {type: 'string'},
+    budgets: {type: 'string', default: path.join(SITE_DIR, 'route-budgets.json')},
+    'set-budgets': {type: 'string'},
+  },
+});
+
+const kib = (bytes) => `${(bytes / 1024).toFixed(1)} KiB`;
+
+const assetSizes = new Map();
+
+/** `{bytes, gzip}` of a file in the build, computed once per file */
+function assetSize(buildDir, url) {
+  if (!assetSizes.has(url)) {
+    const filePath = path.join(buildDir, decodeURIComponent(url.split(/[?#]/)[0]));
+    if (!fs.existsSync(filePath)) {
+      assetSizes.set(url, {bytes: 0, gzip: 0});
+    } else {
+      const buffer = fs.readFileSync(filePath);
+      assetSizes.set(url, {bytes: buffer.length, gzip: zlib.gzipSync(buffer).length});
+    }
+  }
+  return assetSizes.get(url);
+}
+
+const attributeOf = (attributes, name) => {
+  const match = attributes.match(new RegExp(`\\s${name}=(?:"([^"]*)"|'([^']*)'|([^\\s>]+))`, 'i'));
+  return match ? match[1] ?? match[2] ?? match[3] : undefined;
+};
+
+/** URLs the page loads up front, by kind */
+function pageAssets(html) {
+  const assets = {js: new Set(), css: new Set(), images: new Set()};
+  for (const [, tag, attributes] of html.matchAll(/<(script|link|img)\b([^>]*)>/gi)) {
+    const name = tag.toLowerCase();
+    if (name === 'script') {
+      const src = attributeOf(attributes, 'src');
+      if (src) assets.js.add(src);
+    } else if (name === 'img') {
+      const src = attributeOf(attributes, 'src');
+      if (src && !src.startsWith('data:')) assets.images.add(src);
+    } else {
+      const rel = attributeOf(attributes, 'rel') || '';
+      const href = attributeOf(attributes, 'href');
+      if (!href) continue;
+      if (/\bstylesheet\b/.test(rel)) assets.css.add(href);
+      else if (/\bmodulepreload\b/.test(rel) || (/\bpreload\b/.test(rel) && attributeOf(attributes, 'as') === 'script')) {
+        assets.js.add(href);
+      }
+    }
+  }
+  return assets;
+}
+
+const componentCounts = new Map();
+
+/** MDX component tags (`<CopyUrl>`, `<Tabs>`, ...) in a doc and the partials it renders */
+function componentsIn(filePath, seen = new Set()) {
+  if (componentCounts.has(filePath)) return componentCounts.get(filePath);
+  const source = fs.readFileSync(filePath, 'utf8');
+  const partials = new Map();
+  for (const [, name, importPath] of source.matchAll(/^import\s+(\w+)\s+from\s+['"]([^'"]+\.mdx?)['"]/gm)) {
+    const resolved = importPath.startsWith('@site/')
+      ? path.join(SITE_DIR, importPath.slice('@site/'.length))
+      : path.resolve(path.dirname(filePath), importPath);
+    if (fs.existsSync(resolved) && !seen.has(resolved)) partials.set(name, resolved);
+  }
+  let count = 0;
+  for (const [, name] of source.matchAll(/<([A-Z][\w.]*)[\s/>]/g)) {
+    count += partials.has(name) ? componentsIn(partials.get(name), new Set([...seen, filePath])) : 1;
+  }
+  componentCounts.set(filePath, count);
+  return count;
+}
+
+function measureRoutes(buildDir) {
+  const routes = {};
+  const pages = fs
+    .readdirSync(buildDir, {recursive: true})
+    .filter((name) => name.endsWith('.html'))
+    .sort();
+  for (const page of pages) {
+    const buffer = fs.readFileSync(path.join(buildDir, page));
+    const html = buffer.toString('utf8');
+    // Redirect stubs (plugins/redirects)
+    if (/<meta http-equiv="refresh"/i.test(html)) continue;
+    const route = `/${page.split(path.sep).join('/').replace(/(^|\/)index\.html$/, '$1')}`;
+    const assets = pageAssets(html);
+    const total = (urls, key) => [...urls].reduce((sum, url) => sum + assetSize(buildDir, url)[key], 0);
+    const body = html.slice(html.search(/<body\b/i));
+    const source = docFile(route);
+    routes[route] = {
+      html: zlib.gzipSync(buffer).length,
+      js: total(assets.js, 'gzip'),
+      css: total(assets.css, 'gzip'),
+      images: total(assets.images, 'bytes'),
+      domNodes: (body.match(/<[a-z][\w-]*/gi) || []).length,
+      components: source ? componentsIn(source) : 0,
+    };
+  }
+  return routes;
+}
+
+/** Budget of `route`: the longest matching route prefix in `budgets.routes`, over `default` */
+function budgetOf(budgets, route) {
+  const prefix = Object.keys(budgets.routes || {})
+    .filter((candidate) => route.startsWith(candidate))
+    .sort((a, b) => b.length - a.length)[0];
+  return {...budgets.default, ...(prefix && budgets.routes[prefix])};
+}
+
+function checkBudgets(routes, baseline, budgets) {
+  const failures = [];
+  for (const [route, weights] of Object.entries(routes)) {
+    const budget = budgetOf(budgets, route);
+    for (const metric of BUDGETED) {
+      if (budget[metric] !== undefined && weights[metric] > budget[metric] * 1024) {
+        failures.push(`${route}: ${metric} ${kib(weights[metric])} exceeds its budget of ${budget[metric]} KiB`);
+      }
+    }
+    const before = baseline && baseline[route];
+    if (!before || budgets.maxGrowth === undefined) continue;
+    for (const metric of GROWTH_CHECKED) {
+      const growth = before[metric] ? weights[metric] / before[metric] - 1 : 0;
+      if (growth > budgets.maxGrowth && weights[metric] - before[metric] > (budgets.minGrowth || 0) * 1024) {
+        failures.push(
+          `${route}: ${metric} grew ${(growth * 100).toFixed(0)}% (${kib(before[metric])} -> ${kib(weights[metric])}),` +
+            ` more than ${(budgets.maxGrowth * 100).toFixed(0)}% over main`,
+        );
+      }
+    }
+  }
+  return failures;
+}
+
+/**
+ * `routes` budgets from a report: in KiB, rounded up, for the metrics of
+ * the routes heavier than the default budget allows
+ */
+function budgetsFrom(routes, budgets) {
+  const headroom = budgets.headroom ?? 0.2;
+  const overrides = {};
+  for (const [route, weights] of Object.entries(routes)) {
+    // A `/` entry would be the budget of every route (keys are prefixes)
+    if (route === '/') continue;
+    for (const metric of BUDGETED) {
+      const limit = Math.ceil((weights[metric] * (1 + headroom)) / 1024);
+      const fallback = (budgets.default || {})[metric];
+      if (fallback !== undefined && limit > fallback) overrides[route] = {...overrides[route], [metric]: limit};
+    }
+  }
+  return overrides;
+}
+
+/** Markdown table of the routes whose weight changed most since `baseline` */
+function diffTable(routes, baseline) {
+  const delta = (route) =>
+    ['html', 'js', 'css'].reduce((sum, metric) => sum + (routes[route][metric] - ((baseline[route] || {})[metric] || 0)), 0);
+  const changed = Object.keys(routes)
+    .filter((route) => delta(route) !== 0)
+    .sort((a, b) => Math.abs(delta(b)) - Math.abs(delta(a)))
+    .slice(0, SUMMARY_ROWS);
+  const removed = Object.keys(baseline).filter((route) => !routes[route]);
+  const cell = (route, metric) => {
+    const now = routes[route][metric];
+    const before = (baseline[route] || {})[metric];
+    if (before === undefined) return `${kib(now)} (new)`;
+    const change = now - before;
+    return change === 0 ? kib(now) : `${kib(now)} (${change > 0 ? '+' : ''}${kib(change)})`;
+  };
+  const lines = ['| Route | HTML | JS | CSS |', '| --- | --- | --- | --- |'];
+  for (const route of changed) {
+    lines.push(`| \`${route}\` | ${cell(route, 'html')} | ${cell(route, 'js')} | ${cell(route, 'css')} |`);
+  }
+  if (!changed.length) lines.push('| No route changed weight | | | |');
+  if (removed.length) lines.push('', `Removed routes: ${removed.map((route) => `\`${route}\``).join(', ')}`);
+  return lines.join('\n');
+}
+
+function setBudgets(reportPath) {
+  const budgets = JSON.parse(fs.readFileSync(options.budgets, 'utf8'));
+  const {routes} = JSON.parse(fs.readFileSync(reportPath, 'utf8'));
+  budgets.routes = budgetsFrom(routes, budgets);
+  fs.writeFileSync(options.budgets, `${JSON.stringify(budgets, null, 2)}\n`);
+  console.log(
+    `✅ Wrote the budgets of ${Object.keys(budgets.routes).length} routes over the defaults to ${path.relative(SITE_DIR, options.budgets)}`,
+  );
+}
+
+function main() {
+  if (options['set-budgets']) {
+    setBudgets(options['set-budgets']);
+    return;
+  }
+  const buildDir = path.resolve(options.build);
+  if (!fs.existsSync(buildDir)) {
+    console.error(`❌ Missing ${options.build} (run npm run build first).`);
+    process.exit(2);
+  }
+  const routes = measureRoutes(buildDir);
+  fs.writeFileSync(options.output, `${JSON.stringify({metrics: METRICS, routes}, null, 2)}\n`);
+
+  const heaviest = Object.entries(routes).sort(([, a], [, b]) => b.js + b.html - (a.js + a.html))[0];
+  console.log(`📦 Wrote weights of ${Object.keys(routes).length} routes to ${options.output}`);
+  if (heaviest) {
+    console.log(`   heaviest: ${heaviest[0]} (html ${kib(heaviest[1].html)}, js ${kib(heaviest[1].js)} gzip)`);
+  }
+
+  let baseline;
+  if (options.baseline) {
+    if (fs.existsSync(options.baseline)) {
+      baseline = JSON.parse(fs.readFileSync(options.baseline, 'utf8')).routes;
+      const table = diffTable(routes, baseline);
+      console.log('');
+      console.log(table);
+      if (process.env.GITHUB_STEP_SUMMARY) {
+        fs.appendFileSync(process.env.GITHUB_STEP_SUMMARY, `## Route weights (gzip) vs. main\n\n${table}\n`);
+      }
+    } else {
+      console.log(`   no baseline at ${options.baseline}; skipping the comparison`);
+    }
+  }
+
+  const budgets = fs.existsSync(options.budgets) ? JSON.parse(fs.readFileSync(options.budgets, 'utf8')) : {};
+  const failures = checkBudgets(routes, baseline, budgets);
+  if (failures.length && !baseline) {
+    // The budgets aren't set from a main report yet: nothing to hold a change to
+    console.log('');
+    console.log('=== Over budget (report only until main has produced a baseline) ===');
+    for (const failure of failures) {
+      console.log(process.env.GITHUB_ACTIONS ? `::warning title=Route weights::${failure}` : `⚠️  ${failure}`);
+    }
+    return;
+  }
+  if (failures.length) {
+    console.log('');
+    console.log('=== Over budget ===');
+    for (const failure of failures) console.log(`❌ ${failure}`);
+    process.exit(1);
+  }
+  console.log('✅ All routes within budget.');
+}
+
+main();
@@ -0,0 +1,42 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+# Subsets the self-hosted fonts declared in plugins/fonts to the characters
+# the site actually uses and writes WOFF2 files to static/fonts/*/subset/.
+# The plugin picks them up on the next build.
+#
+# requires fonttools with brotli: pip install -r scripts/requirements.txt
+
+cd "$(dirname "$0")/.."
+
+charset="$(mktemp)"
+trap 'rm -f "$charset"' EXIT
+
+# Every character in the docs, components and sidebars, plus printable ASCII
+node -e '
+  const fs = require("fs");
+  const path = require("path");
+  const chars = new Set();
+  for (let code = 0x20; code <= 0x7e; code++) chars.add(String.fromCharCode(code));
+  for (const dir of ["docs", "src"]) {
+    for (const name of fs.readdirSync(dir, {recursive: true})) {
+      if (!/\.(mdx?|tsx?|jsx?|css)$/.test(name)) continue;
+      for (const char of fs.readFileSync(path.join(dir, name), "utf8")) chars.add(char);
+    }
+  }
+  for (const char of fs.readFileSync("sidebars.js", "utf8")) chars.add(char);
+  process.stdout.write([...chars].filter((char) => char >= " ").join(""));
+' > "$charset"
+
+node -e '
+  const {FONTS, subsetPath} = require("./plugins/fonts");
+  for (const font of FONTS) console.log(font.file, subsetPath(font.file));
+' | while read -r file subset; do
+  mkdir -p "static/fonts/$(dirname "$subset")"
+  pyftsubset "static/fonts/$file.otf" \
+    --text-file="$charset" \
+    --layout-features='*' \
+    --flavor=woff2 \
+    --output-file="static/fonts/$subset"
+  echo "$file.otf $(wc -c < "static/fonts/$file.otf") -> $subset $(wc -c < "static/fonts/$subset") bytes"
+done
@@ -0,0 +1,91 @@
+export interface RateLimit {
+  requests: number;
+  per: 'second' | 'minute' | 'hour';
+}
+
+export interface Pagination {
+  style: 'pageNo' | 'offset';
+  /** Page size parameter: `noOfEntries`, `limit` or `pageSize` */
+  sizeParam: string;
+  /** Where the paging parameters go */
+  in: 'query' | 'body';
+  maxPageSize?: number;
+}
+
+export interface OperationParams {
+  path?: Record<string, string | number>;
+  query?: Record<string, unknown>;
+  body?: unknown;
+}
+
+export interface Operation<Params extends OperationParams = OperationParams, Response = unknown> {
+  (client: Client, params: Params): Promise<Response>;
+  method: 'GET' | 'POST' | 'PUT' | 'PATCH' | 'DELETE';
+  path: string;
+  pagination?: Pagination;
+  batchSize?: number;
+  rateLimit?: RateLimit;
+}
+
+export interface ClientOptions {
+  /** Access token, sent as `Authorization: Bearer <token>` */
+  token: string;
+  /** Organization Workspace ID, sent as `X-IAA-OW-ID` */
+  workspaceId?: string | number;
+  /** Defaults to `https://api.iqm.com` */
+  baseUrl?: string;
+  fetch?: typeof fetch;
+  /** Requests in flight at once; defaults to 4 */
+  maxConcurrency?: number;
+  /** Retries of `429` and `503` responses; defaults to 3 */
+  retries?: number;
+  headers?: Record<string, string>;
+}
+
+export interface Client {
+  baseUrl: string;
+  request<Params extends OperationParams, Response>(operation: Operation<Params, Response>, params: Params): Promise<Response>;
+}
+
+export declare class IqmApiError extends Error {
+  status: number;
+  body: unknown;
+}
+
+export declare function createClient(options: ClientOptions): Client;
+
+export type OperationMetadata = Pick<Operation, 'method' | 'path' | 'pagination' | 'batchSize' | 'rateLimit'>;
+
+export declare function defineOperation<Params extends OperationParams, Response>(
+  metadata: OperationMetadata,
+): Operation<Params, Response>;
+
+/** Item type of a paginated response (`data` list or the list inside it) */
+export type PageItem<Response> = Response extends {data?: infer Data}
+  ? Data extends readonly (infer Item)[]
+    ? Item
+    : Data extends object
+      ? {[Key in keyof Data]-?: NonNullable<Data[Key]> extends readonly (infer Item)[] ? Item : never}[keyof Data]
+      : unknown
+  : unknown;
+
+export interface PaginateOptions {
+  /** Defaults to the page size in `params`, else 100, capped at the operation's maximum */
+  pageSize?: number;
+  maxPages?: number;
+}
+
+export declare function paginate<Params extends OperationParams, Response>(
+  client: Client,
+  operation: Operation<Params, Response>,
+  params?: Params,
+  options?: PaginateOptions,
+): AsyncGenerator<PageItem<Response>, void, undefined>;
+
+export declare function batch<Params extends OperationParams, Response, Item>(
+  client: Client,
+  operation: Operation<Params, Response>,
+  items: readonly Item[],
+  toParams: (chunk: Item[]) => Params,
+  options?: {size?: number},
+): Promise<Response[]>;
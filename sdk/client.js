@@ -0,0 +1,233 @@
+/**
+ * Runtime of the IQM SDK. The per-API modules in ./dist (generated by
+ * scripts/generate-sdk.js from static/openapi) only describe operations;
+ * requests go through a client created here, which:
+ *
+ * - reuses connections: one client per process shares the keep-alive
+ *   pool of `fetch` and a single request queue
+ * - keeps at most `maxConcurrency` requests in flight and stays within the
+ *   operation's `x-operational-limits` rate limit, waiting out `429`s
+ * - coalesces identical GET requests already in flight
+ *
+ * `paginate` walks paginated operations page by page and `batch` splits
+ * bulk requests into the operation's batch size.
+ */
+
+const DEFAULT_BASE_URL = 'https://api.iqm.com';
+const PER_MS = {second: 1000, minute: 60_000, hour: 3_600_000};
+
+export class IqmApiError extends Error {
+  constructor(operation, status, body) {
+    const message = body && typeof body === 'object' && (body.message || body.error);
+    super(`${operation.method} ${operation.path} failed with ${status}${message ? `: ${message}` : ''}`);
+    this.name = 'IqmApiError';
+    this.status = status;
+    this.body = body;
+  }
+}
+
+/** Operation descriptor; called with a client it sends the request */
+export function defineOperation(metadata) {
+  const operation = (client, params) => client.request(operation, params);
+  return Object.assign(operation, metadata);
+}
+
+const sleep = (ms) => new Promise((resolve) => setTimeout(resolve, ms));
+
+function retryDelay(response, attempt) {
+  const header = response.headers.get('retry-after');
+  const seconds = Number(header);
+  if (header && !Number.isNaN(seconds)) return seconds * 1000;
+  if (header && !Number.isNaN(Date.parse(header))) return Math.max(0, Date.parse(header) - Date.now());
+  return 500 * 2 ** attempt;
+}
+
+function buildUrl(baseUrl, operation, {path = {}, query = {}} = {}) {
+  const resolved = operation.path.replace(/\{([^}]+)\}/g, (match, name) => {
+    if (path[name] === undefined) throw new TypeError(`Missing path parameter "${name}" for ${operation.path}`);
+    return encodeURIComponent(String(path[name]));
+  });
+  const url = new URL(resolved, baseUrl);
+  for (const [name, value] of Object.entries(query)) {
+    if (value === undefined || value === null) continue;
+    for (const item of Array.isArray(value) ? value : [value]) url.searchParams.append(name, String(item));
+  }
+  return url;
+}
+
+/** Sliding-window limiter shared by the operations with the same rate limit */
+function rateLimiter({requests, per}) {
+  const window = PER_MS[per] || PER_MS.minute;
+  const sent = [];
+  return async function acquire() {
+    for (;;) {
+      const now = Date.now();
+      while (sent.length && now - sent[0] >= window) sent.shift();
+      if (sent.length < requests) {
+        sent.push(now);
+        return;
+      }
+      await sleep(window - (now - sent[0]));
+    }
+  };
+}
+
+export function createClient({
+  token,
+  workspaceId,
+  baseUrl = DEFAULT_BASE_URL,
+  fetch: fetchImpl = globalThis.fetch,
+  maxConcurrency = 4,
+  retries = 3,
+  headers: extraHeaders = {},
+} = {}) {
+  if (typeof fetchImpl !== 'function') throw new TypeError('No fetch implementation available');
+
+  const headers = {
+    Accept: 'application/json',
+    ...(token && {Authorization: `Bearer ${String(token).replace(/^Bearer\s+/i, '')}`}),
+    ...(workspaceId && {'X-IAA-OW-ID': String(workspaceId)}),
+    ...extraHeaders,
+  };
+  const limiters = new Map();
+  const inFlight = new Map();
+  const queue = [];
+  let active = 0;
+
+  function schedule(task) {
+    return new Promise((resolve, reject) => {
+      queue.push({task, resolve, reject});
+      drain();
+    });
+  }
+
+  function drain() {
+    while (active < maxConcurrency && queue.length) {
+      const {task, resolve, reject} = queue.shift();
+      active += 1;
+      task()
+        .then(resolve, reject)
+        .finally(() => {
+          active -= 1;
+          drain();
+        });
+    }
+  }
+
+  function limiterFor(operation) {
+    if (!operation.rateLimit) return undefined;
+    const key = `${operation.rateLimit.requests}/${operation.rateLimit.per}`;
+    if (!limiters.has(key)) limiters.set(key, rateLimiter(operation.rateLimit));
+    return limiters.get(key);
+  }
+
+  async function send(operation, params = {}) {
+    const url = buildUrl(baseUrl, operation, params);
+    const init = {method: operation.method, headers: {...headers}};
+    if (params.body !== undefined) {
+      if (typeof FormData !== 'undefined' && params.body instanceof FormData) {
+        init.body = params.body;
+      } else {
+        init.body = JSON.stringify(params.body);
+        init.headers['Content-Type'] = 'application/json';
+      }
+    }
+    const acquire = limiterFor(operation);
+
+    for (let attempt = 0; ; attempt += 1) {
+      if (acquire) await acquire();
+      const response = await fetchImpl(url, init);
+      if ((response.status === 429 || response.status === 503) && attempt < retries) {
+        await sleep(retryDelay(response, attempt));
+        continue;
+      }
+      const text = await response.text();
+      let body = text;
+      try {
+        body = text ? JSON.parse(text) : undefined;
+      } catch {
+        // Not JSON: returned as text
+      }
+      if (!response.ok) throw new IqmApiError(operation, response.status, body);
+      return body;
+    }
+  }
+
+  function request(operation, params) {
+    if (operation.method !== 'GET') return schedule(() => send(operation, params));
+    const key = buildUrl(baseUrl, operation, params).href;
+    if (!inFlight.has(key)) {
+      const pending = schedule(() => send(operation, params)).finally(() => inFlight.delete(key));
+      inFlight.set(key, pending);
+    }
+    return inFlight.get(key);
+  }
+
+  return {baseUrl, request};
+}
+
+// Pagination
+
+function itemsOf(response) {
+  const data = response && typeof response === 'object' && 'data' in response ? response.data : response;
+  if (Array.isArray(data)) return {items: data};
+  if (data && typeof data === 'object') {
+    const list = Object.values(data).find(Array.isArray);
+    const total = data.filteredRecords ?? data.totalRecords;
+    return {items: list || [], total: typeof total === 'number' ? total : undefined};
+  }
+  return {items: []};
+}
+
+function pageParams(operation, params, page, size) {
+  const {style, sizeParam} = operation.pagination;
+  const location = operation.pagination.in === 'body' ? 'body' : 'query';
+  const position = style === 'offset' ? {offset: page * size} : {pageNo: page + 1};
+  return {...params, [location]: {...params[location], ...position, [sizeParam]: size}};
+}
+
+/**
+ * Items of every page of a paginated operation. The next page is requested
+ * while the current one is consumed; the walk ends at the reported total
+ * or at the first short page.
+ */
+export async function* paginate(client, operation, params = {}, {pageSize, maxPages = Infinity} = {}) {
+  if (!operation.pagination) throw new TypeError(`${operation.method} ${operation.path} is not paginated`);
+  const location = operation.pagination.in === 'body' ? 'body' : 'query';
+  const requested = (params[location] || {})[operation.pagination.sizeParam];
+  const size = Math.min(pageSize || requested || 100, operation.pagination.maxPageSize || Infinity);
+
+  let seen = 0;
+  let next = operation(client, pageParams(operation, params, 0, size));
+  // The prefetched page, until it is awaited
+  let pending;
+  try {
+    for (let page = 0; page < maxPages; page += 1) {
+      const {items, total} = itemsOf(await next);
+      pending = undefined;
+      seen += items.length;
+      const done = items.length < size || (total !== undefined && seen >= total) || page + 1 >= maxPages;
+      if (!done) pending = next = operation(client, pageParams(operation, params, page + 1, size));
+      yield* items;
+      if (done) return;
+    }
+  } finally {
+    // The consumer stopped early (`break`, `return`, a throw): nobody awaits
+    // the prefetched page, whose failure would be an unhandled rejection
+    if (pending) pending.catch(() => {});
+  }
+}
+
+// Batching
+
+/**
+ * Sends `items` to a bulk operation in chunks of `size` (default: the
+ * operation's batch size), `toParams(chunk)` building each request. Chunks
+ * go out concurrently within the client's limits; the responses are
+ * returned in order.
+ */
+export function batch(client, operation, items, toParams, {size = operation.batchSize || 100} = {}) {
+  const chunks = [];
+  for (let index = 0; index < items.length; index += size) chunks.push(items.slice(index, index + size));
+  return Promise.all(chunks.map((chunk) => operation(client, toParams(chunk))));
+}
@@ -11,7370 +11,646 @@
 
 // @ts-check
 
+import {category, doc, endpoint, endpoints, link, step} from './plugins/sidebar/index.js';
+
 /** @type {import('@docusaurus/plugin-content-docs').SidebarsConfig} */
 const sidebars = {
   tutorialSidebar: [
-    {
-      type: 'category',
-      label: 'Getting Started',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'getting-started/index'
-      },
-      items: [
-        {
-          type: 'doc',
-          id: 'getting-started/platform-overview',
-          label: 'IQM Platform Overview',
-          className: 'sidebarItem',
-        },
-        {
-          type: 'doc',
-          id: 'getting-started/rest-api-reference',
-          label: 'REST API Overview',
-          className: 'sidebarItem',
-        },
-        {
-          type: 'doc',
-          id: 'getting-started/before-you-begin',
-          label: 'Before You Begin',
-          className: 'sidebarItem',
-        },
-        {
-          type: 'doc',
-          id: 'getting-started/typescript-prerequisites',
-          label: 'TypeScript Prerequisites',
-          className: 'sidebarItem',
-        },
-        {
-          type: 'doc',
-          id: 'getting-started/api-pagination-guide',
-          label: 'API Filtering and Pagination',
-          className: 'sidebarItem',
-        },
-      ],
-    },
-    {
-      type: "category",
-      label: 'Quickstart Guides',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'quickstart-guides/index'
-      },
-      items: [
-        {
-          type: 'category',
-          label: 'Sign Up and Authenticate',
-          className: 'sidebarItem',
-          link: {
-            type: 'doc',
-            id: 'quickstart-guides/authentication-quickstart-guide'
-          },
-          items: [
-            {
-              type: `link`,
-              label: 'Sign Up',
-              href: `/quickstart-guides/authentication-quickstart-guide#sign-up`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Log In',
-              href: `/quickstart-guides/authentication-quickstart-guide#log-in`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Refresh Token',
-              href: `/quickstart-guides/authentication-quickstart-guide#refresh-token`,
-              className: 'sidebarItemQS'
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Upload a Creative',
-          className: 'sidebarItem',
-          link: {
-            type: 'doc',
-            id: 'quickstart-guides/upload-a-creative-quickstart'
-          },
-          items: [
-            {
-              type: `link`,
-              label: 'About IQM Creatives',
-              href: `/quickstart-guides/upload-a-creative-quickstart#about-iqm-creatives`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Before You Begin',
-              href: `/quickstart-guides/upload-a-creative-quickstart#before-you-begin`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Upload a Creative Using the IQM API',
-              href: `/quickstart-guides/upload-a-creative-quickstart#upload-a-creative-using-the-iqm-api`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 1: Log In',
-              href: `/quickstart-guides/upload-a-creative-quickstart#step-1-log-in`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 2: Request Creative Types',
-              href: `/quickstart-guides/upload-a-creative-quickstart#step-2-request-creative-types`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 3: Upload a Creative',
-              href: `/quickstart-guides/upload-a-creative-quickstart#step-3-upload-a-creative`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 4: Check Creative Status',
-              href: `/quickstart-guides/upload-a-creative-quickstart#step-4-check-creative-status`,
-              className: 'sidebarItemQS'
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Create a Campaign',
-          className: 'sidebarItem',
-          link: {
-            type: 'doc',
-            id: 'quickstart-guides/create-a-campaign-quickstart'
-          },
-          items: [
-            {
-              type: `link`,
-              label: 'About IQM Creatives',
-              href: `/quickstart-guides/create-a-campaign-quickstart#about-iqm-campaigns`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Before You Begin',
-              href: `/quickstart-guides/create-a-campaign-quickstart#before-you-begin`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Create a Campaign Using the IQM API',
-              href: `/quickstart-guides/create-a-campaign-quickstart#create-a-campaign-using-the-iqm-api`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 1: Log in',
-              href: `/quickstart-guides/create-a-campaign-quickstart#step-1-log-in`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 2: Create an Insertion Order',
-              href: `/quickstart-guides/create-a-campaign-quickstart#step-2-create-insertion-order`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 3: Create a Campaign',
-              href: `/quickstart-guides/create-a-campaign-quickstart#step-3-create-a-campaign`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 4: Check Campaign Status',
-              href: `/quickstart-guides/create-a-campaign-quickstart#step-4-check-campaign-status`,
-              className: 'sidebarItemQS'
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Create a Contextual Audience',
-          className: 'sidebarItem',
-          link: {
-            type: 'doc',
-            id: 'quickstart-guides/contextual-audience-quickstart'
-          },
-          items: [
-            {
-              type: `link`,
-              label: 'About IQM Contextual Audiences',
-              href: `/quickstart-guides/contextual-audience-quickstart#about-iqm-contextual-audiences`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 1: Log In',
-              href: `/quickstart-guides/contextual-audience-quickstart#step-1-log-in`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 2: Create a Contextual Audience',
-              href: `/quickstart-guides/contextual-audience-quickstart#step-2-create-a-contextual-audience`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 3: Check Audience Status',
-              href: `/quickstart-guides/contextual-audience-quickstart#step-3-check-audience-status`,
-              className: 'sidebarItemQS'
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Run a Report',
-          className: 'sidebarItem',
-          link: {
-            type: 'doc',
-            id: 'quickstart-guides/reporting-api-quickstart-guide'
-          },
-          items: [
-            {
-              type: `link`,
-              label: 'About IQM Reports',
-              href: `/quickstart-guides/reporting-api-quickstart-guide#about-iqm-reports`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Run a Report Using the IQM API',
-              href: `/quickstart-guides/reporting-api-quickstart-guide#run-a-report-using-the-iqm-api`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 1: Log In',
-              href: `/quickstart-guides/reporting-api-quickstart-guide#step-1-log-in`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 2: Request Dimensions and Metrics',
-              href: `/quickstart-guides/reporting-api-quickstart-guide#step-2-request-dimensions-and-metrics`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 3: Select Timezones',
-              href: `/quickstart-guides/reporting-api-quickstart-guide#step-3-select-timezones`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 4: Execute a Report',
-              href: `/quickstart-guides/reporting-api-quickstart-guide#step-4-execute-a-report`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'FAQ',
-              href: `/quickstart-guides/reporting-api-quickstart-guide#faq`,
-              className: 'sidebarItemQS'
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Schedule a Report',
-          className: 'sidebarItem',
-          link: {
-            type: 'doc',
-            id: 'quickstart-guides/schedule-report-api-quickstart-guide'
-          },
-          items: [
-            {
-              type: `link`,
-              label: 'About IQM Reports',
-              href: `/quickstart-guides/schedule-report-api-quickstart-guide#about-iqm-reports`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Schedule a Report',
-              href: `/quickstart-guides/schedule-report-api-quickstart-guide#schedule-a-report-1`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 1: Log In',
-              href: `/quickstart-guides/schedule-report-api-quickstart-guide#step-1-log-in`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 2: Schedule a Report',
-              href: `/quickstart-guides/schedule-report-api-quickstart-guide#step-2-schedule-a-report`,
-              className: 'sidebarItemQS'
-            },
-          ]
-        },
-      ],
-    },
-    {
-      type: "category",
-      label: 'Tutorials',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'tutorials/index'
-      },
-      items: [
-        {
-          type: 'category',
-          label: 'Create a Bid Model',
-          className: 'sidebarItem',
-          link: {
-            type: 'doc',
-            id: 'quickstart-guides/bid-model-quickstart'
-          },
-          items: [
-            {
-              type: `link`,
-              label: 'About IQM Bid Modeling',
-              href: `/tutorials/create-a-bid-model#about-iqm-bid-modeling`,
-              className: 'sidebarItemQS'
-            },
-                 {
-              type: `link`,
-              label: 'Before You Begin',
-              href: `/tutorials/create-a-bid-model#before-you-begin`,
-              className: 'sidebarItemQS'
-            },
-                 {
-              type: `link`,
-              label: 'Bid Modeling Criteria',
-              href: `/tutorials/create-a-bid-model#bid-modeling-criteria`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 1: Check Campaign for Eligibility',
-              href: `/tutorials/create-a-bid-model#step-1-check-campaign-for-eligibility`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 2: Select Dimension',
-              href: `/tutorials/create-a-bid-model#step-2-select-dimension`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 3: Create a Bid Model',
-              href: `/tutorials/create-a-bid-model#step-3-create-a-bid-model`,
-              className: 'sidebarItemQS'
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Create a Conversion',
-          className: 'sidebarItem',
-          link: {
-            type: 'doc',
-            id: 'quickstart-guides/conversion-quickstart'
-          },
-          items: [
-            {
-              type: `link`,
-              label: 'About IQM Conversions',
-              href: `/tutorials/create-a-conversion#about-iqm-conversions`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Create a Conversion',
-              href: `/tutorials/create-a-conversion#create-a-conversion-using-the-iqm-api`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 1: Log In',
-              href: `/tutorials/create-a-conversion#step-1-log-in`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 2: Create a Pixel Conversion',
-              href: `/tutorials/create-a-conversion#step-2-create-a-pixel-conversion`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 3: Assign a Conversion to a Campaign',
-              href: `/tutorials/create-a-conversion#step-3-assign-a-conversion-to-a-campaign`,
-              className: 'sidebarItemQS'
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Create a Deal',
-          className: 'sidebarItem',
-          link: {
-            type: 'doc',
-            id: 'tutorials/deal-guide'
-          },
-          items: [
-            {
-              type: `link`,
-              label: 'About IQM Deals',
-              href: `/tutorials/deal-guide#about-iqm-deals`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Before You Begin',
-              href: `/tutorials/deal-guide#before-you-begin`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Request Exchange List',
-              href: `/tutorials/deal-guide#request-exchange-list`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Create a PG Deal',
-              href: `/tutorials/deal-guide#create-a-pg-deal`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Create a PMP Deal',
-              href: `/tutorials/deal-guide#create-a-pmp-deal`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Assign Deals to Campaign',
-              href: `/tutorials/deal-guide#assign-deals-to-a-campaign`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'List of Deals and Campaigns',
-              href: `/tutorials/deal-guide#get-list-of-deals-associated-with-campaigns`,
-              className: 'sidebarItemQS'
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Create an Insights Report',
-          className: 'sidebarItem',
-          link: {
-            type: 'doc',
-            id: 'quickstart-guides/insights-quickstart'
-          },
-          items: [
-            {
-              type: `link`,
-              label: 'About IQM Insights',
-              href: `/tutorials/create-an-insights-report#about-iqm-insights`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Before You Begin',
-              href: `/tutorials/create-an-insights-report#before-you-begin`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Eligibility Requirements',
-              href: `/tutorials/create-an-insights-report#eligibility-requirements`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Campaign Bidding Insights',
-              href: `/tutorials/create-an-insights-report#campaign-bidding-insights`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Audience Insights Report',
-              href: `/tutorials/create-an-insights-report#audience-insights-report`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Voter Level Data Report',
-              href: `/tutorials/create-an-insights-report#voter-level-data-report`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Provider Level Data Report',
-              href: `/tutorials/create-an-insights-report#provider-level-data-report`,
-              className: 'sidebarItemQS'
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Create a PG Campaign',
-          className: 'sidebarItem',
-          link: {
-            type: 'doc',
-            id: 'quickstart-guides/upload-creative-and-create-a-campaign-api-quickstart-guide'
-          },
-          items: [
-            {
-              type: `link`,
-              label: 'About IQM PG Campaigns',
-              href: `/tutorials/create-a-pg-campaign#about-iqm-pg-campaigns`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Before You Begin',
-              href: `/tutorials/create-a-pg-campaign#before-you-begin`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Create a PG Campaign Using the IQM API',
-              href: `/tutorials/create-a-pg-campaign#create-a-pg-campaign-using-the-iqm-api`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 1: Log in',
-              href: `/tutorials/create-a-pg-campaign#step-1-log-in`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 2: Create a PG Campaign',
-              href: `/tutorials/create-a-pg-campaign#step-2-create-a-pg-campaign`,
-              className: 'sidebarItemQS'
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Optimize Your Inventory',
-          className: 'sidebarItem',
-          link: {
-            type: 'doc',
-            id: 'quickstart-guides/inventory-quickstart'
-          },
-          items: [
-            {
-              type: `link`,
-              label: 'About IQM Inventory',
-              href: `/tutorials/optimize-your-inventory#about-iqm-inventory`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Optimize Your Inventory',
-              href: `/tutorials/optimize-your-inventory#optimize-your-inventory-using-the-iqm-api`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 1: Log In',
-              href: `/tutorials/optimize-your-inventory#step-1-log-in`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 2: Search Inventory List ',
-              href: `/tutorials/optimize-your-inventory#step-2-search-inventory-list`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 3: Create an Inventory Group',
-              href: `/tutorials/optimize-your-inventory#step-3-create-an-inventory-group`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 4: Update an Inventory Group',
-              href: `/tutorials/optimize-your-inventory#step-4-update-an-inventory-group`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 5: Campaign Inventory Group Targeting',
-              href: `/tutorials/optimize-your-inventory#step-5-campaign-inventory-group-targeting`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 6: Get List of Campaigns by Group',
-              href: `/tutorials/optimize-your-inventory#step-6-get-list-of-campaigns-by-group`,
-              className: 'sidebarItemQS'
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Sign Up a New Customer',
-          className: 'sidebarItem',
-          link: {
-            type: 'doc',
-            id: 'tutorials/customer-guide'
-          },
-          items: [
-            {
-              type: `link`,
-              label: 'About IQM Customers',
-              href: `/tutorials/customer-guide#about-iqm-customers`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Before You Begin',
-              href: `/tutorials/customer-guide#before-you-begin`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Sign Up a New Customer Using the IQM API',
-              href: `/tutorials/customer-guide#sign-up-a-new-customer-using-the-iqm-api`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Invite a Customer',
-              href: `/tutorials/customer-guide#invite-a-customer`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Sign Up a Customer',
-              href: `/tutorials/customer-guide#sign-up-a-customer`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Approve a Customer',
-              href: `/tutorials/customer-guide#approve-a-customer`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Assign Customer to User',
-              href: `/tutorials/customer-guide#assign-customer-to-user`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Add Customer App Access',
-              href: `/tutorials/customer-guide#add-customer-app-access`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Add Payment for Customer',
-              href: `/tutorials/customer-guide#add-payment-for-customer`,
-              className: 'sidebarItemQS'
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Upload a Matched Audience',
-          className: 'sidebarItem',
-          link: {
-            type: 'doc',
-            id: 'quickstart-guides/matched-audience-upload-api-quickstart-guide'
-          },
-          items: [
-            {
-              type: `link`,
-              label: 'About IQM Matched Audience',
-              href: `/tutorials/upload-a-matched-audience#about-iqm-matched-audience`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Before You Begin',
-              href: `/tutorials/upload-a-matched-audience#before-you-begin`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Upload Matched Audience Using the IQM API',
-              href: `/tutorials/upload-a-matched-audience#upload-matched-audience-using-the-iqm-api`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 1: Log In',
-              href: `/tutorials/upload-a-matched-audience#step-1-log-in`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 2: Request Column List',
-              href: `/tutorials/upload-a-matched-audience#step-2-request-column-list`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 3: Upload Matched Audience',
-              href: `/tutorials/upload-a-matched-audience#step-3-upload-matched-audience`,
-              className: 'sidebarItemQS'
-            },
-            {
-              type: `link`,
-              label: 'Step 4: Check Audience Status',
-              href: `/tutorials/upload-a-matched-audience#step-4-check-audience-status`,
-              className: 'sidebarItemQS'
-            },
-          ]
-        },
-      ]
-    },
-    {
-      type: `doc`,
-      label: `API Guidelines`,
-      id: `guidelines/index`,
-      className: `sidebarCategory`,
-    },
-    {
-      type: 'category',
-      label: 'Assets API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'guidelines/asset-api'
-      },
-      items: [
-        {
-          type: 'category',
-          label: 'Assets Details',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'List of All Assets',
-              href: '/guidelines/asset-api#get-a-list-of-all-assets',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Asset Details',
-              href: '/guidelines/asset-api#get-asset-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Assets Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Add Multiple Assets',
-              href: '/guidelines/asset-api#add-multiple-assets',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Asset Details',
-              href: '/guidelines/asset-api#update-asset-details',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Delete Asset',
-              href: '/guidelines/asset-api#delete-asset',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-      ],
-    },
-    {
-      type: 'category',
-      label: 'Audience API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'guidelines/audience-api'
-      },
-      items: [
-        {
-          type: 'category',
-          label: 'Audience Details',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Audience Details List',
-              href: '/guidelines/audience-api#audience-details-list',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Basic Audience Details',
-              href: '/guidelines/audience-api#basic-audience-details',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Audience Count by Status',
-              href: '/guidelines/audience-api#audience-count-by-status',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Audience Count by Type',
-              href: '/guidelines/audience-api#audience-count-by-type',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Audience Count by Data Partner',
-              href: '/guidelines/audience-api#audience-count-by-data-partner',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Audience Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Update Audience Name',
-              href: '/guidelines/audience-api#update-audience-name',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Regenerate Audience',
-              href: '/guidelines/audience-api#regenerate-audience',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Audience Insights',
-              href: '/guidelines/audience-api#get-audience-insights',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Create Audience Insights',
-              href: '/guidelines/audience-api#create-audience-insights',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Attach Data Partner',
-              href: '/guidelines/audience-api#attach-data-partner',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Delete Audience',
-              href: '/guidelines/audience-api#delete-audience',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            }
-          ]
-        },
-        {
-          type: `category`,
-          label: `Matched Audiences`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Matched Audience Details',
-              href: '/guidelines/audience-api#matched-audience-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Create Matched Audience',
-              href: '/guidelines/audience-api#create-matched-audience',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Matched Audience',
-              href: '/guidelines/audience-api#update-matched-audience',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Refresh Matched Audience',
-              href: '/healthcare-vertical/audience-healthcare#refresh-matched-audience',
-              customProps: { method: 'PUT' },
-            },
-            {
-              type: 'link',
-              label: 'Matched Data Partners',
-              href: '/guidelines/audience-api#data-partners-list-for-matched-audience',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Matched Data Formats',
-              href: '/guidelines/audience-api#data-formats-list-for-matched-audience',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Matched Column List',
-              href: '/guidelines/audience-api#matched-column-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Matched Column Combinations',
-              href: '/guidelines/audience-api#matched-column-combinations',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Download Matched Audience File',
-              href: '/guidelines/audience-api#download-matched-audience-file',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            }
-          ]
-        },
-        {
-          type: `category`,
-          label: `Segmented Audiences`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Segmented Audience Details',
-              href: '/guidelines/audience-api#segmented-audience-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Search Segmented Audiences',
-              href: '/guidelines/audience-api#search-segmented-audiences',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Create Segmented Audience',
-              href: '/guidelines/audience-api#create-segmented-audience',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Segmented Audience',
-              href: '/guidelines/audience-api#update-segmented-audience',
-              customProps: { method: 'PUT' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Segment Partner Provider List',
-              href: '/guidelines/audience-api#segment-partner-provider-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Segment List by Provider/Partner IDs',
-              href: '/guidelines/audience-api#segment-list-by-providerpartner-ids',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            }
-          ]
-        },
-        {
-          type: `category`,
-          label: `Retargeted Audiences`,
-          className: 'sidebarItem',
-          items: [
-          {
-              type: 'link',
-              label: 'Create Retargeted Audience',
-              href: '/guidelines/audience-api#create-retargeted-audience',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Retargeted Audience',
-              href: '/guidelines/audience-api#update-retargeted-audience',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Retargeted Audience Email',
-              href: '/guidelines/audience-api#retargeted-audience-email-notification',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Geofarmed Audiences`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Geofarmed Audience Details',
-              href: '/guidelines/audience-api#geofarmed-audience-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Create Geofarmed Audience',
-              href: '/guidelines/audience-api#create-geofarmed-audience',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            }
-          ]
-        },
-        {
-          type: `category`,
-          label: `Contextual Audiences`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Contextual Audience Details',
-              href: '/guidelines/audience-api#contextual-audience-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Create Contextual Audience',
-              href: '/guidelines/audience-api#create-contextual-audience',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Validate URL for Contextual Audience',
-              href: '/guidelines/audience-api#validate-url-for-contextual-audience',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            }
-          ]
-        },
-        {
-          type: `category`,
-          label: `Lookalike Audiences`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Lookalike Audience Details',
-              href: '/guidelines/audience-api#get-lookalike-audience-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Create Lookalike Audience',
-              href: '/guidelines/audience-api#create-lookalike-audience',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            }
-          ]
-        },
-        {
-          type: `category`,
-          label: `Campaign Audiences`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Campaign Audience Details',
-              href: '/guidelines/audience-api#campaign-audience-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Create Campaign Audience',
-              href: '/guidelines/audience-api#create-campaign-audience',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Campaign Audience History',
-              href: '/guidelines/audience-api#get-campaign-audience-history',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            }
-          ]
-        },
-        {
-          type: `category`,
-          label: `Pre-bid Audiences`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Pre-bid Audience Details',
-              href: '/guidelines/audience-api#pre-bid-audience-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Search Pre-bid Audience Details',
-              href: '/guidelines/audience-api#search-pre-bid-audience-details',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Create Pre-bid Audience',
-              href: '/guidelines/audience-api#create-pre-bid-audience',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Pre-bid Audience',
-              href: '/guidelines/audience-api#update-pre-bid-audience',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Get Pre-bid Provider Child Segment Details',
-              href: '/guidelines/audience-api#get-pre-bid-provider-child-segment-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Get Prebid Child Segment Details',
-              href: '/guidelines/audience-api#get-pre-bid-child-segment-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'DoubleVerify Pre-bid Audience Segment',
-              href: '/guidelines/audience-api#doubleverify-pre-bid-audience-segment-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            }
-          ]
-        },
-        {
-          type: `category`,
-          label: `More Audience Details`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Segmented Reach Range',
-              href: '/guidelines/audience-api#reach-range-list-for-segmented-audiences',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Segmented Price Range',
-              href: '/guidelines/audience-api#price-range-list-for-segmented-audiences',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Audience Type List',
-              href: '/guidelines/audience-api#audience-type-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Audience Subtype List',
-              href: '/guidelines/audience-api#audience-subtype-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Audience Status List',
-              href: '/guidelines/audience-api#audience-status-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Frequency Type List',
-              href: '/guidelines/audience-api#frequency-type-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            }
-          ]
-        },
-      ],
-    },
-    {
-      type: 'category',
-      label: 'Bid Model API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'guidelines/bid-model-api'
-      },
-      items: [
-        {
-          type: 'category',
-          label: 'Bid Model Details',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Bid Model Bundles List',
-              href: '/guidelines/bid-model-api#get-list-of-bid-model-bundles',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Modeled Entities',
-              href: '/guidelines/bid-model-api#get-modeled-entities',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Campaign Dimension Statistics',
-              href: '/guidelines/bid-model-api#get-campaign-dimension-statistics',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Campaign Spending by Dimension',
-              href: '/guidelines/bid-model-api#get-dimension-specific-spending-for-a-campaign',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Modeled Entities for a Campaign',
-              href: '/guidelines/bid-model-api#get-list-of-modeled-entities-for-a-campaign',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Include/Exclude Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Devices, Exchanges, Traffic',
-              href: '/guidelines/bid-model-api#includeexclude-management',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Campaign Entities',
-              href: '/guidelines/bid-model-api#includeexclude-entities-from-a-campaign',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            }
-          ]
-        },
-        {
-          type: `category`,
-          label: `Bid Model Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Bid Modeling Criteria',
-              href: '/guidelines/bid-model-api#bid-modeling-criteria',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Manage Bid Modeling',
-              href: '/guidelines/bid-model-api#manage-bid-modeling',
-              customProps: { method: 'PUT' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Create Bid Model Bundle',
-              href: '/guidelines/bid-model-api#create-bid-model-bundle',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Bid Model Bundle',
-              href: '/guidelines/bid-model-api#update-bid-model-bundle',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Delete Bid Model Bundle',
-              href: '/guidelines/bid-model-api#delete-bid-model-bundle',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'IO Bid Modeling',
-              href: '/guidelines/bid-model-api#manage-insertion-order-bid-modeling',
-              customProps: { method: 'PUT' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'IO Priority',
-              href: '/guidelines/bid-model-api#manage-insertion-order-priority',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            }
-          ]
-        },
-        {
-          type: `category`,
-          label: `Bid Model Metrics and Dimensions`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Metrics Report for a Given Campaign & Dimension',
-              href: '/guidelines/bid-model-api#get-metrics-report-for-a-given-campaign-and-dimension',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Bid Model Dimensions',
-              href: '/guidelines/bid-model-api#get-list-of-bid-model-dimensions',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ],
-        },
-      ]
-    },
-    {
-      type: 'category',
-      label: 'Campaign API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'guidelines/campaign-api'
-      },
-      items: [
-        {
-          type: 'category',
-          label: 'Campaign Details',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Campaign Resource Details',
-              href: '/guidelines/campaign-api#campaign-resource-properties',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Campaign Details by ID',
-              href: '/guidelines/campaign-api#get-campaign-details-by-id',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Campaigns',
-              href: '/guidelines/campaign-api#get-list-of-campaigns',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Campaigns with Basic Details',
-              href: '/guidelines/campaign-api#get-list-of-campaigns-with-basic-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Basic Details of Campaigns',
-              href: '/guidelines/campaign-api#get-basic-details-of-campaigns',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Campaign Audience Targeting Details',
-              href: '/guidelines/campaign-api#get-campaign-audience-targeting-details',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Campaigns with Filters',
-              href: '/guidelines/campaign-api#get-list-of-campaigns-with-filters',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Campaign Budget Details',
-              href: '/guidelines/campaign-api#get-campaign-budget-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Campaign Groups',
-              href: '/guidelines/campaign-api#get-list-of-campaign-groups',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Campaign Deals',
-              href: '/guidelines/campaign-api#get-deals-associated-with-campaigns',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Campaign Count by Status',
-              href: '/guidelines/campaign-api#get-campaign-count-by-status',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Campaign Count with Type',
-              href: '/guidelines/campaign-api#get-campaign-count-with-campaign-type',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Campaign Count by Creative Type',
-              href: '/guidelines/campaign-api#get-campaign-count-by-creative-type',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Creative Type and Campaign Count',
-              href: '/guidelines/campaign-api#get-creative-type-and-campaigns-count',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          {
-              type: 'link',
-              label: 'Campaign Conversion List',
-              href: '/guidelines/campaign-api#get-campaign-conversion-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Basic Conversion List',
-              href: '/guidelines/campaign-api#get-basic-conversion-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Campaign Start Date',
-              href: '/guidelines/campaign-api#get-campaign-start-date',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Campaign Start/End Dates',
-              href: '/guidelines/Campaign-API-guidelines/#get-list-of-campaign-start-dates-or-end-dates',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Campaign Report Data',
-              href: '/guidelines/campaign-api#get-campaign-report-data',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Campaign Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Create New Campaign',
-              href: '/guidelines/campaign-api#create-new-campaign',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Campaign',
-              href: '/guidelines/campaign-api#update-campaign',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Create New PG Campaign',
-              href: '/guidelines/campaign-api#create-new-pg-campaign',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update PG Campaign',
-              href: '/guidelines/campaign-api#update-pg-campaign',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Change Campaign Name',
-              href: '/guidelines/campaign-api#change-campaign-name',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Change Campaign End Date',
-              href: '/guidelines/campaign-api#change-campaign-end-date',
-              customProps: { method: 'PUT' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Change Campaign Budget',
-              href: '/guidelines/campaign-api#change-campaign-budget',
-              customProps: { method: 'PUT' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Campaign Status',
-              href: '/guidelines/campaign-api#update-campaign-status',
-              customProps: { method: 'PUT' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Duplicate Campaigns',
-              href: '/guidelines/campaign-api#duplicate-campaigns',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Get Campaign Cost Details',
-              href: '/guidelines/campaign-api#get-campaign-cost-details',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Get Audience Reach Estimation',
-              href: '/guidelines/campaign-api#get-audience-reach-estimation',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Get Bid Landscape Estimation',
-              href: '/guidelines/campaign-api#get-bid-landscape-estimation',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Resend Email to Set Margin',
-              href: '/guidelines/campaign-api#resend-email-to-set-margin',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Resend Email Reminder to Set Invoice Template',
-              href: '/guidelines/campaign-api#resend-email-reminder-to-set-invoice-template',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Campaign Templates`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Get List of Campaign Templates',
-              href: '/guidelines/campaign-api#get-list-of-campaign-templates',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Get Campaign Template Details',
-              href: '/guidelines/campaign-api#get-campaign-template-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Create Campaign Template',
-              href: '/guidelines/campaign-api#create-campaign-template',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Campaign Targeting`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Update Audience Targeting',
-              href: '/guidelines/campaign-api#update-audience-targeting-in-campaigns',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Creative Targeting',
-              href: '/guidelines/campaign-api#update-creative-targeting-in-campaigns',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Inventory Group Targeting',
-              href: '/guidelines/campaign-api#inventory-group-targeting',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Assign PMP Deals',
-              href: '/guidelines/campaign-api#assign-pmp-deals',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Assign PG Deals',
-              href: '/guidelines/campaign-api#assign-pg-deals',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Insertion Order Details`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'IO Resource Properties',
-              href: '/guidelines/campaign-api#insertion-order-resource-properties',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'IO Details by ID',
-              href: '/guidelines/campaign-api#get-insertion-order-details-by-id',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'IO Details',
-              href: '/guidelines/campaign-api#get-insertion-order-details',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Advanced IO Details',
-              href: '/guidelines/campaign-api#get-advanced-insertion-order-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Download Advanced IO Details',
-              href: '/guidelines/campaign-api#download-advanced-io-details',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Get IO Campaign Budget and Details',
-              href: '/guidelines/campaign-api#get-io-campaign-budget-and-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Campaign Details Grouped by IO ID',
-              href: '/guidelines/campaign-api#get-list-of-campaign-details-grouped-by-insertion-order-id',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Campaign Details Grouped by IO ID with Filters',
-              href: '/guidelines/campaign-api#get-list-of-campaign-details-grouped-by-io-id-with-filters',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Campaigns and Report Details by IO ID',
-              href: '/guidelines/campaign-api#get-list-of-campaigns-and-report-details-by-insertion-order-id',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Download csv/xlsx File for IO-based Campaign Details',
-              href: '/guidelines/campaign-api#download-csvxlsx-file-for-io-based-campaign-details',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of IO Start/End Dates',
-              href: '/guidelines/campaign-api#get-list-of-io-startend-dates',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Insertion Order Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Create an Insertion Order',
-              href: '/guidelines/campaign-api#create-an-insertion-order',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Insertion Order Details',
-              href: '/guidelines/campaign-api#update-insertion-order-details',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update End Date for Multiple IOs',
-              href: '/guidelines/campaign-api#update-end-date-for-multiple-ios',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Budget for Multiple IOs',
-              href: '/guidelines/campaign-api#update-budget-for-multiple-ios',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Duplicate an Insertion Order',
-              href: '/guidelines/campaign-api#duplicate-an-insertion-order',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Delete an Insertion Order',
-              href: '/guidelines/campaign-api#delete-an-insertion-order',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Get More Details`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Frequency Cap Types',
-              href: '/guidelines/campaign-api#get-frequency-cap-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Goal-AI Objectives and Goals',
-              href: '/guidelines/campaign-api#get-goal-ai-objectives-and-goals',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Estimator Dimension List',
-              href: '/guidelines/campaign-api#get-estimator-dimension-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of IO Status',
-              href: '/guidelines/campaign-api#get-io-status-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Campaign Budget Types',
-              href: '/guidelines/campaign-api#get-list-of-campaign-budget-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Budget Distribution Methods',
-              href: '/guidelines/campaign-api#get-list-of-budget-distribution-methods',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-      ],
-    },
-    {
-      type: 'category',
-      label: 'Conversions API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'guidelines/conversion-api'
-      },
-      items: [
-        {
-          type: 'category',
-          label: 'Conversion Details',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Postback Conversion Resource Details',
-              href: '/guidelines/conversion-api#postback-conversion-resource-properties',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Pixel Conversion Resource Details',
-              href: '/guidelines/conversion-api#pixel-conversion-resource-properties',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Conversion Details by ID',
-              href: '/guidelines/conversion-api#get-conversion-details-by-id',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Conversions',
-              href: '/guidelines/conversion-api#get-list-of-conversions',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Conversion Count by Type',
-              href: '/guidelines/conversion-api#get-conversion-count-by-type',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Campaign Details by Conversion ID',
-              href: '/guidelines/conversion-api#get-campaign-details-by-conversion-id',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Campaign Details by Conversion ID in Group or Basic',
-              href: '/guidelines/conversion-api#get-campaign-details-by-conversion-id-in-group-or-basic',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Conversions Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Create Pixel Conversion',
-              href: '/guidelines/conversion-api#create-pixel-conversion',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Pixel Conversion',
-              href: '/guidelines/conversion-api#update-pixel-conversion',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Create Postback Conversion',
-              href: '/guidelines/conversion-api#create-postback-conversion',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Postback Conversion',
-              href: '/guidelines/conversion-api#update-postback-conversion',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Create Universal Pixel Conversion',
-              href: '/guidelines/conversion-api#create-a-universal-pixel-conversion',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Universal Pixel Conversion',
-              href: '/guidelines/conversion-api#update-a-universal-pixel-conversion',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Delete Conversion',
-              href: '/guidelines/conversion-api#delete-conversion',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Assign Conversion to a Campaign',
-              href: '/guidelines/conversion-api#assign-conversion-to-a-campaign',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Send Email for Pixel Integration',
-              href: '/guidelines/conversion-api#send-email-for-pixel-integration',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Send Email for Universal Pixel Integration',
-              href: '/guidelines/conversion-api#send-email-for-universal-pixel-integration',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `More Conversion Details`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'List of Partner Types for Postback Conversions',
-              href: '/guidelines/conversion-api#get-list-of-partner-types-for-postback-conversions',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Pixel Conversion Advanced Setting Default Values',
-              href: '/guidelines/conversion-api#get-list-of-pixel-conversion-advanced-setting-default-values',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Conversion Types',
-              href: '/guidelines/conversion-api#get-list-of-conversion-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Conversion Status',
-              href: '/guidelines/conversion-api#get-list-of-conversion-status',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Conversion Piggyback Types',
-              href: '/guidelines/conversion-api#get-list-of-conversion-piggyback-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Conversion Property Types',
-              href: '/guidelines/conversion-api/#get-list-of-conversion-property-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-      ],
-    },
-    {
-      type: 'category',
-      label: 'Creative API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'guidelines/creative-api'
-      },
-      items: [
-        {
-          type: 'category',
-          label: 'Creative Details',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Creative Details by ID',
-              href: '/guidelines/creative-api#creative-details-by-id',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Creatives and Details',
-              href: '/guidelines/creative-api#get-list-of-creatives-and-details',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Associated Campaigns',
-              href: '/guidelines/creative-api#get-associated-campaigns',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Creative Groups',
-              href: '/guidelines/creative-api#get-list-of-creative-groups',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Creative Count by Type',
-              href: '/guidelines/creative-api#get-creative-count-by-type',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Creative Count by Status',
-              href: '/guidelines/creative-api#get-creative-count-by-status',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Creative Management',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Add New Creative',
-              href: '/guidelines/creative-api#add-new-creative',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Creative Details',
-              href: '/guidelines/creative-api#update-creative-details',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Creative Status',
-              href: '/guidelines/creative-api#update-creative-status',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Create New Creative Group',
-              href: '/guidelines/creative-api#create-new-creative-group',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Delete Creative Group',
-              href: '/guidelines/creative-api#delete-creative-group',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Creative Groups',
-              href: '/guidelines/creative-api#update-creative-groups',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Creative Group Name',
-              href: '/guidelines/creative-api#update-creative-group-name',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Duplicate Creatives',
-              href: '/guidelines/creative-api#duplicate-creatives',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Duplicate Creative Group',
-              href: '/guidelines/creative-api#duplicate-creative-group',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Compress Image',
-              href: '/guidelines/creative-api#compress-uploaded-image-creative',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Pixel URL',
-              href: '/guidelines/creative-api#update-pixel-url',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Click URL',
-              href: '/guidelines/creative-api#update-click-url',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Get HTML5 Creative Content',
-              href: '/guidelines/creative-api#get-html5-creative-content',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update HTML5 Creative Content',
-              href: '/guidelines/creative-api#update-html5-creative-content',
-              customProps: { method: 'PUT' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Submit Creatives for Validation',
-              href: '/guidelines/creative-api#submit-creatives-for-validation',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Approve Creative',
-              href: '/guidelines/creative-api#approve-creative',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'More Creative Details',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Creative Types List',
-              href: '/guidelines/creative-api#get-creative-types-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Creative Status List',
-              href: '/guidelines/creative-api#get-creative-status-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'CTA Details',
-              href: '/guidelines/creative-api#get-cta-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        }
-      ]
-    },
-    {
-      type: 'category',
-      label: 'Dashboard API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'guidelines/dashboard-api'
-      },
-      items: [
-        {
-          type: 'category',
-          label: 'Dashboard Details',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Dashboard List',
-              href: '/guidelines/dashboard-api#dashboard-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Get Campaign Goal AI Graph Data',
-              href: '/guidelines/dashboard-api#get-campaign-goal-ai-graph-data',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Get Campaign Goal AI Optimization Activity',
-              href: '/guidelines/dashboard-api#get-campaign-goal-ai-optimization-activity',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Dashboard Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Create Dashboard',
-              href: '/guidelines/dashboard-api#create-dashboard',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Dashboard',
-              href: '/guidelines/dashboard-api#update-dashboard',
-              customProps: { method: 'PUT' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Delete Dashboard',
-              href: '/guidelines/dashboard-api#delete-dashboard',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Dashboard Reports`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Resource Properties',
-              href: '/guidelines/dashboard-api#dashboard-reports-resource-properties',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Workspace Report',
-              href: '/guidelines/dashboard-api#workspace-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'IO Report',
-              href: '/guidelines/dashboard-api#io-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Exchange Report',
-              href: '/guidelines/dashboard-api#exchange-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Customer Report',
-              href: '/guidelines/dashboard-api#customer-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Campaign Report',
-              href: '/guidelines/dashboard-api#campaign-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Metrics Timeline',
-              href: '/guidelines/dashboard-api#metrics-timeline',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Metrics Comparison',
-              href: '/guidelines/dashboard-api#metrics-comparison',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-      ],
-    },
-    {
-      type: 'category',
-      label: 'Finance API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'guidelines/finance-api'
-      },
-      items: [
-        {
-          type: 'category',
-          label: 'Finance Details',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Customer Finance Details',
-              href: '/guidelines/finance-api#finance-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Customer Margin Details',
-              href: '/guidelines/finance-api#get-customer-margin-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Customer Margin Details',
-              href: '/guidelines/finance-api#update-customer-margin-details',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Organization Margin Settings',
-              href: '/guidelines/finance-api#get-organization-margin-settings',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Organization Margin Settings',
-              href: '/guidelines/finance-api#update-organization-margin-settings',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Campaign Margin Details',
-              href: '/guidelines/finance-api#campaign-margin-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Customer PG Fees Details',
-              href: '/guidelines/finance-api#get-customer-pg-fees-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Edit Customer PG Fees',
-              href: '#edit-customer-pg-fees',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Customer Insights Fees Details',
-              href: '/guidelines/finance-api/#get-customer-insights-fees-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Customer Insights Fees Details',
-              href: '/guidelines/finance-api/#update-customer-insights-fees-details',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Customer DoubleVerify IVT Flag',
-              href: '/guidelines/finance-api#get-customer-doubleverify-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Customer DoubleVerify IVT Flag',
-              href: '/guidelines/finance-api#update-customer-doubleverify',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Basic Financial Details',
-              href: '/guidelines/finance-api#get-basic-financial-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Available Balance',
-              href: '/guidelines/finance-api#available-balance',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Add Ad Serving Cost',
-              href: '/guidelines/finance-api#add-ad-serving-cost',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Get Ad Serving Cost',
-              href: '/guidelines/finance-api#get-ad-serving-cost',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Add or Update Third Party Cost',
-              href: '/guidelines/finance-api#add-or-update-third-party-cost',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Get Third Party Cost',
-              href: '/guidelines/finance-api#get-third-party-cost',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Disable Third Party Cost',
-              href: '/guidelines/finance-api#disable-third-party-cost',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Invoice Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Invoice for Organization',
-              href: '/guidelines/finance-api#get-invoice-for-organization',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Invoice Payment Details',
-              href: '/guidelines/finance-api#get-invoice-payment-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Invoices for Customer or Organization',
-              href: '/guidelines/finance-api#get-list-of-invoices-for-customer-or-organization',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Invoice Settings',
-              href: '/guidelines/finance-api#update-invoice-settings',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Delete Invoice Tax Data',
-              href: '/guidelines/finance-api#delete-invoice-tax-data',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Approve Invoice',
-              href: '/guidelines/finance-api#approve-invoice',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Cancel Invoice',
-              href: '/guidelines/finance-api#cancel-invoice',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Mark Invoice as Paid',
-              href: '/guidelines/finance-api#mark-invoice-as-paid',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Email Invoice',
-              href: '/guidelines/finance-api#email-invoice',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Download Invoice',
-              href: '/guidelines/finance-api#download-invoice',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Invoice Template Margin Details',
-              href: '/guidelines/finance-api#get-invoice-template-margin-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Invoice Template Margin Pre-Requisite',
-              href: '/guidelines/finance-api#get-invoice-template-margin-pre-requisite',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Credit Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Credit Summary',
-              href: '/guidelines/finance-api#credit-summary',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Offered Credits',
-              href: '/guidelines/finance-api#offered-credits',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Customer Credit List',
-              href: '/guidelines/finance-api#customer-credit-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Add Credit to Customer',
-              href: '/guidelines/finance-api#add-credit-to-customer',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Credit Offered to Customer',
-              href: '/guidelines/finance-api#update-credit-offered-to-customer',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Revoke Credit Offered to Customer',
-              href: '/guidelines/finance-api#revoke-credit-offered-to-customer',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Claim Offered Credits',
-              href: '/guidelines/finance-api#claim-offered-credits',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Payment Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'List of Payment Transactions for Organization',
-              href: '/guidelines/finance-api#get-list-of-payment-transactions-for-organization',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Customer Payments',
-              href: '/guidelines/finance-api#get-list-of-customer-payments',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Add Payment for Customer',
-              href: '/guidelines/finance-api#add-payment-for-customer',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Edit Customer Payment',
-              href: '/guidelines/finance-api#edit-customer-payment',
-              customProps: { method: 'PUT' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Approve Payment',
-              href: '/guidelines/finance-api#approve-payment',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Cancel Payment',
-              href: '/guidelines/finance-api#cancel-payment',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Reject Payment',
-              href: '/guidelines/finance-api#reject-payment',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Add Payment from Organization App',
-              href: '/guidelines/finance-api#add-payment-from-organization-app',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Payment with PayPal',
-              href: '/guidelines/finance-api#payment-with-paypal',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'PayPal Payment Success Callback',
-              href: '/guidelines/finance-api#paypal-payment-success-callback',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'PayPal Payment Cancel Callback',
-              href: '/guidelines/finance-api#paypal-payment-cancel-callback',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Complete PayPal Payment',
-              href: '/guidelines/finance-api#complete-paypal-payment',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Initiate Refund',
-              href: '/guidelines/finance-api#initiate-refund',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Approve Refund',
-              href: '/guidelines/finance-api#approve-refund',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Email Payment Receipt',
-              href: '/guidelines/finance-api#email-payment-receipt',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Download Payment Receipt',
-              href: '/guidelines/finance-api#download-payment-receipt',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Add or Update Payment Comment',
-              href: '/guidelines/finance-api#add-or-update-payment-comment',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Static Details Lists`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Payment Types',
-              href: '/guidelines/finance-api#static-details-lists',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Payment Status',
-              href: '/guidelines/finance-api#payment-status',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Invoice Payment Mode Types',
-              href: '/guidelines/finance-api#invoice-payment-mode-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Invoice Status',
-              href: '/guidelines/finance-api#invoice-status',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Invoice Payment Term',
-              href: '/guidelines/finance-api#invoice-payment-term',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'PG Payment Type',
-              href: '/guidelines/finance-api#pg-payment-type',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-      ],
-    },
-    {
-      type: 'category',
-      label: 'Insights API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'guidelines/insights-api'
-      },
-      items: [
-        {
-          type: 'category',
-          label: 'Insights Details',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'List of Insights',
-              href: '/guidelines/insights-api#get-insights-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Campaign Bidding Insights',
-              href: '/guidelines/insights-api#get-campaign-bidding-insights',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Insights Count by Type',
-              href: '/guidelines/insights-api#get-insights-count-by-type',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Get Eligible Campaigns',
-              href: '/guidelines/insights-api#get-eligible-campaigns',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Calculate Insights Computation',
-              href: '/guidelines/insights-api#calculate-insights-computation',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            }
-          ]
-        },
-        {
-          type: `category`,
-          label: `Insights Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Delete Insights Record',
-              href: '/guidelines/insights-api#delete-insights-record',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Regenerate Insights Report',
-              href: '/guidelines/insights-api#regenerate-insights-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Send Insights Email',
-              href: '/guidelines/insights-api#send-insights-email',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Audience Insights`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'List of Eligible Audiences',
-              href: '/guidelines/insights-api#get-a-list-of-eligible-audiences',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Matched Audience Details',
-              href: '/guidelines/insights-api#get-matched-audience-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Matched Audience File URL',
-              href: '/guidelines/insights-api#get-matched-audience-file-url',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Create Audience Insights',
-              href: '/guidelines/insights-api#create-audience-insights',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Download Insights Report',
-              href: '/guidelines/insights-api#download-insights-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-                {
-          type: 'category',
-          label: 'Audience Quality Score Reports',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'AQS Eligibility Requirements',
-              href: '/guidelines/insights-api#aqs-eligibility-requirements',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'AQS Resource Properties',
-              href: '/guidelines/insights-api#aqs-resource-properties',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of AQS Reports',
-              href: '/guidelines/insights-api#get-list-of-aqs-reports',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Campaigns Eligible for AQS Reports',
-              href: '/guidelines/insights-api#get-list-of-campaigns-eligible-for-aqs-reports',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Validate AQS Report Name',
-              href: '/guidelines/insights-api#validate-aqs-report-name',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Compute AQS Report Cost',
-              href: '/guidelines/insights-api#compute-aqs-report-cost',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Generate AQS Report',
-              href: '/guidelines/insights-api#generate-aqs-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'AQS Report Types',
-              href: '/guidelines/insights-api#get-aqs-report-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Download AQS Report',
-              href: '/guidelines/insights-api#download-aqs-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Delete AQS Report',
-              href: '/guidelines/insights-api#delete-aqs-report',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Voter Level Data Reports`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'VLD Eligibility Requirements',
-              href: '/guidelines/insights-api#vld-eligibility-requirements',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'VLD Resource Properties',
-              href: '/guidelines/insights-api#voter-level-data-reports',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of VLD Reports',
-              href: '/guidelines/insights-api#get-list-of-vld-reports',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Campaigns Eligible for VLD Reports',
-              href: '/guidelines/insights-api#get-list-of-campaigns-eligible-for-vld-reports',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Generate VLD Report',
-              href: '/guidelines/insights-api#generate-vld-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Cost Assessment for VLD Report',
-              href: '/guidelines/insights-api#get-cost-assessment-for-vld-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Download VLD Insight Report',
-              href: '/guidelines/insights-api#download-vld-insight-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Delete VLD Report',
-              href: '/guidelines/insights-api#delete-vld-report',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-                {
-          type: 'category',
-          label: 'ScriptLift Studies Reports',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'SLS Eligibility Requirements',
-              href: '/guidelines/insights-api#sls-eligiblity-requirements',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'SLS Resource Properties',
-              href: '/guidelines/insights-api#sls-resource-properties',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of SLS Reports',
-              href: '/guidelines/insights-api#get-list-of-sls-reports',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Generate SLS Report',
-              href: '/guidelines/insights-api#generate-sls-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'SLS Reports Computation',
-              href: '/guidelines/insights-api#sls-reports-computation',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Validate SLS Report Name',
-              href: '/guidelines/insights-api#validate-sls-report-name',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Campaigns Eligible for SLS Reports',
-              href: '/guidelines/insights-api#get-list-of-campaigns-eligible-for-sls-reports',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Download SLS Insight Report',
-              href: '/guidelines/insights-api#download-sls-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Delete SLS Report',
-              href: '/guidelines/insights-api#delete-sls-report',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Report Templates`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'PLD Eligibility Requirements',
-              href: '/guidelines/insights-api#pld-eligibility-requirements',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'NLD Eligibility Requirements',
-              href: '/guidelines/insights-api#nld-eligibility-requirements',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'ICT Eligibility Requirements',
-              href: '/guidelines/insights-api#ict-eligibility-requirements',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Templates',
-              href: '/guidelines/insights-api#get-list-of-templates',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Template Details',
-              href: '/guidelines/insights-api#get-template-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Template Reports',
-              href: '/guidelines/insights-api#get-template-reports',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Validate Template Name',
-              href: '/guidelines/insights-api#validate-template-name',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Create Report Template',
-              href: '/guidelines/insights-api#create-report-template',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Report Template',
-              href: '/guidelines/insights-api#update-report-template',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Report Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Download Report',
-              href: '/guidelines/insights-api#download-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Delete Report',
-              href: '/guidelines/insights-api#delete-report',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Email Report',
-              href: '/guidelines/insights-api#email-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Regenerate Report',
-              href: '/guidelines/insights-api#regenerate-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `More Insights Details`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'List of Insights Types',
-              href: '/guidelines/insights-api#get-more-insights-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Insights Status',
-              href: '/guidelines/insights-api#get-list-of-insights-status',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Template Statuses',
-              href: '/guidelines/insights-api#get-list-of-template-statuses',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Scheduling Frequencies',
-              href: '/guidelines/insights-api#get-scheduling-frequencies',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-      ],
-    },
-    {
-      type: 'category',
-      label: 'Inventory API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'guidelines/inventory-api'
-      },
-      items: [
-        {
-          type: 'category',
-          label: 'Inventory Details',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Query Parameters',
-              href: '/guidelines/inventory-api#get-inventory-details',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Inventories',
-              href: '/guidelines/inventory-api#get-list-of-inventories',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Inventory Distribution',
-              href: '/guidelines/inventory-api#get-inventory-distribution',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Inventories Count',
-              href: '/guidelines/inventory-api#get-inventories-count',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Inventory Group Types',
-              href: '/guidelines/inventory-api#get-inventory-group-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Blocked Inventories',
-              href: '/guidelines/inventory-api#get-list-of-blocked-inventories',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Inventory Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Campaign Inventory Targeting',
-              href: '/guidelines/inventory-api#campaign-inventory-targeting',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Block Inventories',
-              href: '/guidelines/inventory-api#block-inventories',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Unblock Inventories',
-              href: '/guidelines/inventory-api#unblock-inventories',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Add Comment for Blocked Inventory',
-              href: '/guidelines/inventory-api#add-comment-for-blocked-inventory',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Block Inventory File',
-              href: '/guidelines/inventory-api#block-inventory-file',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Download CSV Inventory List',
-              href: '/guidelines/inventory-api#download-csv-inventory-list',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Inventory Based on CSV File',
-              href: '/guidelines/inventory-api#get-inventory-based-on-csv-file',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Distribution of Inventory Based on CSV File',
-              href: '/guidelines/inventory-api#get-distribution-of-inventory-based-on-csv-file',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Inventory Count Based on CSV File',
-              href: '/guidelines/inventory-api#get-inventory-count-based-on-csv-file',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Fetch Contextual Inventories',
-              href: '/guidelines/inventory-api#fetch-contextual-inventories',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Add Contextual Inventories',
-              href: '/guidelines/inventory-api#add-contextual-inventories',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Remove Contextual Inventories',
-              href: '/guidelines/inventory-api#remove-contextual-inventories',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Add Contextual Inventories to Groups',
-              href: '/guidelines/inventory-api#add-contextual-inventories-to-inventory-groups',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `CTV Inventories`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'CTV Inventory List',
-              href: '/guidelines/inventory-api#get-ctv-inventory-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'CTV Inventories Count',
-              href: '/guidelines/inventory-api#get-ctv-inventories-count',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'CTV Inventories Distribution',
-              href: '/guidelines/inventory-api#get-ctv-inventories-distribution',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Download CTV Inventory List',
-              href: '/guidelines/inventory-api#download-ctv-inventory-list',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Inventory Groups`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'List of Inventory Groups',
-              href: '/guidelines/inventory-api#inventory-groups',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Shared Group Customer Details',
-              href: '/guidelines/inventory-api#get-list-of-shared-group-customer-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Inventory Groups Statistics',
-              href: '/guidelines/inventory-api#get-list-of-inventory-groups-statistics',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of PMP Deals In an Inventory Group',
-              href: '/guidelines/inventory-api#get-list-of-pmp-deals-in-an-inventory-group',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'CSV List of PMP Deals In an Inventory Group',
-              href: '/guidelines/inventory-api#get-csv-list-of-pmp-deals-in-an-inventory-group',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Open Exchange Inventories In an Inventory Group',
-              href: '/guidelines/inventory-api#get-list-of-open-exchange-inventories-in-an-inventory-group',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Distributions of Open Exchange Inventories In an Inventory Group',
-              href: '/guidelines/inventory-api#get-distributions-of-open-exchange-inventories-in-an-inventory-group',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Count of Open Exchange Inventories In an Inventory Group',
-              href: '/guidelines/inventory-api#get-count-of-open-exchange-inventories-in-an-inventory-group',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Contextual Inventories For an Inventory Group',
-              href: '/guidelines/inventory-api#get-list-of-contextual-inventories-for-an-inventory-group',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Count of Contextual Inventories For an Inventory Group',
-              href: '/guidelines/inventory-api#get-count-of-contextual-inventories-for-an-inventory-group',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'CSV File of Contextual Inventories For an Inventory Group',
-              href: '/guidelines/inventory-api#get-csv-file-of-contextual-inventories-for-an-inventory-group',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Contextual Inventory',
-              href: '/guidelines/inventory-api#contextual-inventory',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Get Inventory Groups Count',
-              href: '/guidelines/inventory-api#get-inventory-groups-count',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Download Open Exchange Inventories for Group',
-              href: '/guidelines/inventory-api#download-open-exchange-inventories-for-group',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'CTV Inventories for an Inventory Group',
-              href: '/guidelines/inventory-api#get-ctv-inventories-for-an-inventory-group',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'CTV Inventories Statistics for an Inventory Group',
-              href: '/guidelines/inventory-api#get-ctv-inventories-statistics-for-an-inventory-group',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'CTV Inventories Distributions for an Inventory Group',
-              href: '/guidelines/inventory-api#get-ctv-inventories-distributions-for-an-inventory-group',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Download CTV Inventories for an Inventory Group',
-              href: '/guidelines/inventory-api#download-ctv-inventories-for-an-inventory-group',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Inventory Group Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Create a New Inventory Group',
-              href: '/guidelines/inventory-api#inventory-group-management',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Add or Remove Mappings to an Inventory Group',
-              href: '/guidelines/inventory-api#add-or-remove-mappings-to-an-inventory-group',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Add or Remove Customers From a Shared Inventory Group',
-              href: '/guidelines/inventory-api#add-or-remove-customers-from-a-shared-inventory-group',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Edit Inventory Group',
-              href: '/guidelines/inventory-api#edit-inventory-group',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Delete Inventory Group',
-              href: '/guidelines/inventory-api#delete-inventory-group',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Add Contextual Inventories to Group',
-              href: '/guidelines/inventory-api#add-contextual-inventories-to-group',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Remove Contextual Inventories from Group',
-              href: '/guidelines/inventory-api#remove-contextual-inventories-from-group',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Validate Inventory Group',
-              href: '/guidelines/inventory-api#validate-inventory-group',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Deals Details',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'List of Deals',
-              href: '/guidelines/inventory-api#list-of-deals',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'List of Deal Types',
-              href: '/guidelines/inventory-api#get-list-of-deal-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'List of Deal Statuses',
-              href: '/guidelines/inventory-api#get-list-of-deal-statuses',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-          ]
-        },
-
-        {
-          type: `category`,
-          label: `Private Marketplace (PMP) Deals Details`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'List of PMP Deals',
-              href: '/guidelines/inventory-api#get-pmp-deals-list',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'PMP Deal Details by IDs',
-              href: '/guidelines/inventory-api#get-pmp-deal-details-by-ids',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'List of Customers Associated with Campaigns for a PMP Deal',
-              href: '/guidelines/inventory-api#get-list-of-customers-associated-with-campaigns-for-a-pmp-deal',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Count of PMP Deals for All statuses',
-              href: '/guidelines/inventory-api#get-count-of-pmp-deals-for-all-statuses',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            }
-          ]
-        },
-        {
-          type: `category`,
-          label: `PMP Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Resource Properties',
-              href: '/guidelines/inventory-api#pmp-management',
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Create PMP Deal',
-              href: '/guidelines/inventory-api#create-pmp-deal',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Update PMP Deal',
-              href: '/guidelines/inventory-api#update-pmp-deal',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Delete PMP Deal',
-              href: '/guidelines/inventory-api#delete-pmp-deal',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem',
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Programmatic Guaranteed (PG) Deals Details`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'List of PG Deals',
-              href: '/guidelines/inventory-api#get-pg-deals-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'PG Deals Details by ID',
-              href: '/guidelines/inventory-api#get-pg-deals-details-by-id',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `PG Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Resource Properties',
-              href: '/guidelines/inventory-api#pg-management',
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Create PG Deal',
-              href: '/guidelines/inventory-api#create-pg-deal',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Update PG Deal Details',
-              href: '/guidelines/inventory-api#update-pg-deal-details',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Delete PG Deal',
-              href: '/guidelines/inventory-api#delete-pg-deal',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem',
-            },
-          ]
-        },
-      ],
-    },
-    {
-      type: 'category',
-      label: 'Master API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'guidelines/master-api'
-      },
-      items: [
-        {
-          type: 'category',
-          label: 'Geographical Data',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Filtering and Pagination',
-              href: '/guidelines/master-api#filtering-and-pagination',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Zip Codes and State IDs',
-              href: '/guidelines/master-api#get-zip-codes-and-state-ids',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'State Segment',
-              href: '/guidelines/master-api#get-state-segment',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Senate District Segment',
-              href: '/guidelines/master-api#get-senate-district-segment',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'House District Segment',
-              href: '/guidelines/master-api#get-house-district-segment',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Gender Segment',
-              href: '/guidelines/master-api#get-gender-segment',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Age Segment',
-              href: '/guidelines/master-api#get-age-segment',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Language Segment',
-              href: '/guidelines/master-api#get-language-segment',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Interest Segment',
-              href: '/guidelines/master-api#get-interest-segment',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Income Range Segment',
-              href: '/guidelines/master-api#get-income-range-segment',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Ethnicity Segment',
-              href: '/guidelines/master-api#get-ethnicity-segment',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Ethnicity Group Segment',
-              href: '/guidelines/master-api#get-ethnicity-group-segment',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'DMA Code Segment',
-              href: '/guidelines/master-api#get-dma-code-segment',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'County Segment',
-              href: '/guidelines/master-api#get-county-segment',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Country Segment',
-              href: '/guidelines/master-api#get-country-segment',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'  
-            },
-            {
-              type: 'link',
-              label: 'Congressional District Segment',
-              href: '/guidelines/master-api#get-congressional-district-segment',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'City Segment',
-              href: '/guidelines/master-api#get-city-segment',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Location Types',
-              href: '/guidelines/master-api#get-location-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Location Details by Location Type',
-              href: '/guidelines/master-api#get-location-details-by-location-type',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Timezones',
-              href: '/guidelines/master-api#get-timezones',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Carriers and States by Country ID',
-              href: '/guidelines/master-api#get-carriers-and-states-by-country-id',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Creative Data`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Query Parameters',
-              href: '/guidelines/master-api#get-creative-data',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'RTB Creative Types',
-              href: '/guidelines/master-api#get-rtb-creative-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Creative Sizes',
-              href: '/guidelines/master-api#get-creative-sizes',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Video Skip Parameters',
-              href: '/guidelines/master-api#get-video-skip-parameters',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Video Roll Position Parameters',
-              href: '/guidelines/master-api#get-video-roll-position-parameters',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Video Player Size Parameters',
-              href: '/guidelines/master-api#get-video-player-size-parameters',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Video Playback Method Parameters',
-              href: '/guidelines/master-api#get-video-playback-method-parameters',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Video Placement Type Parameters',
-              href: '/guidelines/master-api#get-video-placement-type-parameters',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `More Data`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Network Types for Targeting',
-              href: '/guidelines/master-api#get-network-types-for-targeting',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Device OS for Targeting',
-              href: '/guidelines/master-api#get-device-os-for-targeting',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Manufacturers for Targeting',
-              href: '/guidelines/master-api#get-manufacturers-for-targeting',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Channels for Inventory',
-              href: '/guidelines/master-api#get-channels-for-inventory',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Verticals',
-              href: '/guidelines/master-api#get-verticals',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Traffic Types',
-              href: '/guidelines/master-api#get-traffic-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Inventory Types',
-              href: '/guidelines/master-api#get-inventory-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Exchanges',
-              href: '/guidelines/master-api#get-exchanges',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Deal Curation Types',
-              href: '/guidelines/master-api#get-deal-curation-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Publisher Ad Categories',
-              href: '/guidelines/master-api#get-publisher-ad-categories',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Device Type',
-              href: '/guidelines/master-api#get-device-type',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Inventory',
-              href: '/guidelines/master-api#get-inventory',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-      ],
-    },
-    {
-      type: 'category',
-      label: 'Planner API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'guidelines/planner-api'
-      },
-      items: [
-        {
-          type: 'category',
-          label: 'Proposal Details',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Proposal Details by ID',
-              href: '/guidelines/planner-api#get-proposal-details-by-id',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Proposals',
-              href: '/guidelines/planner-api#get-list-of-proposals',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Reach and Impressions Summary',
-              href: '/guidelines/planner-api#proposal-reach-and-impressions-summary',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Device Type Summary',
-              href: '/guidelines/planner-api#proposal-device-type-summary',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Channel Type Summary',
-              href: '/guidelines/planner-api#proposal-channel-type-summary',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Bid Landscape Summary',
-              href: '/guidelines/planner-api#proposal-bid-landscape-summary',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Download Proposal',
-              href: '/guidelines/planner-api#download-proposal',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Proposal Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Create Proposal',
-              href: '/guidelines/planner-api#create-proposal',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Create Draft Proposal',
-              href: '/guidelines/planner-api#create-draft-proposal',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Proposal',
-              href: '/guidelines/planner-api#update-proposal',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Draft Proposal',
-              href: '/guidelines/planner-api#update-draft-proposal',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Generate Campaigns',
-              href: '/guidelines/planner-api#generate-campaigns-for-ready-proposal',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Restore Proposal',
-              href: '/guidelines/planner-api#restore-proposal',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Duplicate Proposal',
-              href: '/guidelines/planner-api#duplicate-proposal',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Delete Proposal',
-              href: '/guidelines/planner-api#delete-proposal',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `More Details`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Proposal Status List',
-              href: '/guidelines/planner-api#proposal-status-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Parameters List',
-              href: '/guidelines/planner-api#proposal-summary-parameters-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'User Access Details',
-              href: '/guidelines/planner-api#get-user-access-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-      ],
-    },
-    {
-      type: 'category',
-      label: 'Reports API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'guidelines/reports-api'
-      },
-      items: [
-        {
-          type: 'category',
-          label: 'Reports Details',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'List of Reports',
-              href: '/guidelines/reports-api#get-reports-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Report by ID',
-              href: '/guidelines/reports-api#get-report-by-id',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Reports Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Resource Properties',
-              href: '/guidelines/reports-api#reports-management',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Create Report',
-              href: '/guidelines/reports-api#create-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Execute a Report',
-              href: '/guidelines/reports-api#execute-a-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Delete a Report',
-              href: '/guidelines/reports-api#delete-a-report',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Edit a Report',
-              href: '/guidelines/reports-api#edit-a-report',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Duplicate a Report',
-              href: '/guidelines/reports-api#duplicate-a-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Scheduling Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Schedule a Report',
-              href: '/guidelines/reports-api#scheduling-management',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update a Report Schedule',
-              href: '/guidelines/reports-api#update-a-report-schedule',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Delete a Report Schedule',
-              href: '/guidelines/reports-api#delete-report-schedule',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Unsubscribe an Email from All Scheduled Reports',
-              href: '/guidelines/reports-api#unsubscribe-an-email-from-all-scheduled-reports',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Unsubscribe an Email from a Report Schedule',
-              href: '/guidelines/reports-api#unsubscribe-an-email-from-a-report-schedule',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Get More Report Details`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'URL for Report Download',
-              href: '/guidelines/reports-api#get-more-report-details',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Conversion\'s Custom Fields',
-              href: '/guidelines/reports-api#get-a-list-of-conversions-custom-fields',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Report Request Types',
-              href: '/guidelines/reports-api#get-report-request-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Report File Types',
-              href: '/guidelines/reports-api#get-report-file-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Report Delivery Frequency Types',
-              href: '/guidelines/reports-api#get-report-delivery-frequency-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Dimensions and Metrics Details',
-              href: '/guidelines/reports-api#get-dimensions-and-metrics-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-      ],
-    },
-    {
-      type: 'category',
-      label: 'User Management API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'guidelines/user-api'
-      },
-      items: [
-        {
-          type: 'category',
-          label: 'Authentication',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'User Login',
-              href: '/guidelines/user-api#login',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'OAuth Token',
-              href: '/guidelines/user-api#oauth-token',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'User Logout',
-              href: '/guidelines/user-api#user-logout',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Change Password',
-              href: '/guidelines/user-api#change-password',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Reset User Password',
-              href: '/guidelines/user-api#reset-user-password',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Reset Password Email',
-              href: '/guidelines/user-api#reset-password-email',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Send MFA Code',
-              href: '/guidelines/user-api#send-mfa-code',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Verify MFA Code',
-              href: '/guidelines/user-api#verify-mfa-code',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            }
-          ]
-        },
-        {
-          type: 'category',
-          label: 'User Details',
-          className: 'sidebarItem',
-          items: [
-              {
-                type: 'link',
-                label: 'List of Users',
-                href: '/guidelines/user-api#get-list-of-users',
-                customProps: { method: 'GET' },
-                className: "sidebarItem"
-              },
-              {
-                type: 'link',
-                label: 'Basic User List',
-                href: '/guidelines/user-api#basic-user-list',
-                customProps: { method: 'GET' },
-                className: "sidebarItem"
-              },
-              {
-                type: 'link',
-                label: 'Users for Customer Sharing',
-                href: '/guidelines/user-api#users-for-customer-sharing',
-                customProps: { method: 'GET' },
-                className: "sidebarItem"
-              },
-              {
-                type: 'link',
-                label: 'User Profile Details',
-                href: '/guidelines/user-api#get-user-profile-details',
-                customProps: { method: 'GET' },
-                className: "sidebarItem"
-              },
-              {
-                type: 'link',
-                label: 'User Config Details',
-                href: '/guidelines/user-api#user-config-details',
-                customProps: { method: 'GET' },
-                className: "sidebarItem"
-              },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'User Management',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Send User Invitation',
-              href: '/guidelines/user-api#send-user-invitation',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Resend User Invitation',
-              href: '/guidelines/user-api#resend-user-invitation',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'User Sign-Up',
-              href: '/guidelines/user-api#user-sign-up',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update User Profile',
-              href: '/guidelines/user-api#update-user-profile',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update User Status',
-              href: '/guidelines/user-api#update-user-status',
-              customProps: { method: 'PUT' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Enable MFA',
-              href: '/guidelines/user-api#enable-mfa',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Disable MFA',
-              href: '/guidelines/user-api#disable-mfa',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            }
-          ]
-        },
-        {
-          type: 'category',
-          label: 'User Application Access',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Allowed Applications List',
-              href: '/guidelines/user-api#allowed-applications-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'User App Access List',
-              href: '/guidelines/user-api#user-app-access-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Add App Access for User',
-              href: '/guidelines/user-api#add-app-access-for-user',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Revoke App Access for User',
-              href: '/guidelines/user-api#revoke-app-access-for-user',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Remaining Applications',
-              href: '/guidelines/user-api#remaining-applications',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Validations',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'User Invite',
-              href: '/guidelines/user-api/#validate-user-invite',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Password Reset Hash',
-              href: '/guidelines/user-api/#validate-password-reset-hash',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'User Email',
-              href: '/guidelines/user-api/#validate-user-email',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Workspace Domain',
-              href: '/guidelines/user-api/#validate-workspace-domain',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'User Email for Sign-Up',
-              href: '/guidelines/user-api/#validate-user-email-for-signup',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'User Password',
-              href: '/guidelines/user-api/#validate-user-password',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-      ],
-    },
-    {
-      type: 'category',
-      label: 'Workspace API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'guidelines/workspace-api'
-      },
-      items: [
-        {
-          type: 'category',
-          label: 'Organization Details',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Resource Properties',
-              href: '/guidelines/workspace-api#organization-details',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Allowed Organizations',
-              href: '/guidelines/workspace-api#get-list-of-allowed-organizations',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Organization Details',
-              href: '/guidelines/workspace-api#get-organization-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Check for Available Domain',
-              href: '/guidelines/workspace-api#check-for-available-domain',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Organization Applications List',
-              href: '/guidelines/workspace-api#organization-applications-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'User Interaction Events',
-              href: '/guidelines/workspace-api#get-list-of-user-interaction-events',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Upsert Interaction Event',
-              href: '/guidelines/workspace-api#upsert-interaction-event',
-              customProps: { method: 'PUT' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Organization Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Update Organization Profile',
-              href: '/guidelines/workspace-api#organization-management',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Organization Email',
-              href: '/guidelines/workspace-api#update-organization-email',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Admin User List',
-              href: '/guidelines/workspace-api#get-list-of-admin-users',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            }
-          ]
-        },
-        {
-          type: `category`,
-          label: `Whitelabel Settings`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Get Whitelabel Settings',
-              href: '/guidelines/workspace-api#get-whitelabel-settings',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Whitelabel Settings',
-              href: '/guidelines/workspace-api#update-whitelabel-settings',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Add Whitelabel Domain',
-              href: '/guidelines/workspace-api#add-whitelabel-domain',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Verify Whitelabel Domain',
-              href: '/guidelines/workspace-api#verify-whitelabel-domain',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Add Whitelabel Pixel URL',
-              href: '/guidelines/workspace-api#add-whitelabel-pixel-url',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Workspace Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Create a Workspace',
-              href: '/guidelines/workspace-api#workspace-management',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Workspace Domain',
-              href: '/guidelines/workspace-api#update-workspace-domain',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Validate Workspace Domain',
-              href: '/guidelines/workspace-api#validate-workspace-domain',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Workspaces',
-              href: '/guidelines/workspace-api#get-list-of-workspaces',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Workspace Initialization Details',
-              href: '/guidelines/workspace-api#get-workspace-initialization-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Workspace Organization Logo',
-              href: '/guidelines/workspace-api#get-workspace-organization-logo',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Workspace Chatbot App ID',
-              href: '/guidelines/workspace-api#get-workspace-chatbot-app-id',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Workspace Chatbot App ID by Domain',
-              href: '/guidelines/workspace-api#get-workspace-chatbot-app-id-by-domain',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Find My Workspace Email',
-              href: '/guidelines/workspace-api#send-find-my-workspace-email',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Customer Details`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Customer Resource Properties',
-              href: '/guidelines/workspace-api#customer-details',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Customer Operations Resource Properties',
-              href: '/guidelines/workspace-api#customer-operations-resource-properties',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Customer Details',
-              href: '/guidelines/workspace-api#get-customer-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Basic Customer Details',
-              href: '/guidelines/workspace-api#get-basic-customer-details',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Multi-level Customers List',
-              href: '/guidelines/workspace-api#get-multi-level-customers-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Immediate Customers List',
-              href: '/guidelines/workspace-api#get-immediate-customers-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Customer Operations Details',
-              href: '/guidelines/workspace-api#get-customer-operations-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Customer Operations Label List',
-              href: '/guidelines/workspace-api#get-customer-operations-label-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Count of Customers by Status',
-              href: '/guidelines/workspace-api#get-count-of-customers-by-status',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Users for Selected Customer',
-              href: '/guidelines/workspace-api#get-list-of-users-for-selected-customer',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of User Assigned Customers',
-              href: '/guidelines/workspace-api#get-list-of-user-assigned-customers',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'User\'s Remaining Customers',
-              href: '/guidelines/workspace-api#get-users-remaining-customers',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Customer\'s Allowed Applications',
-              href: '/guidelines/workspace-api#get-list-of-customers-allowed-applications',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Allowed Customer OW IDs',
-              href: '/guidelines/workspace-api#get-allowed-customer-ow-ids',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Remaining Apps for Customer',
-              href: '/guidelines/workspace-api#get-list-of-remaining-apps-for-customer',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Remaining Applications for User',
-              href: '/guidelines/workspace-api#get-remaining-applications-for-user',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Metabase Client Credentials',
-              href: '/guidelines/workspace-api#get-metabase-client-credentials',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Advertisers for Customer',
-              href: '/guidelines/workspace-api#get-list-of-advertisers-for-customer',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Customer Config Details',
-              href: '/guidelines/workspace-api#get-customer-config-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Customer Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Invitation Pre-Requisite Details',
-              href: '/guidelines/workspace-api#invitation-pre-requisite-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Invite Customer to Platform',
-              href: '/guidelines/workspace-api#customer-management',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Resend Customer Invite',
-              href: '/guidelines/workspace-api#resend-customer-invite',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Cancel Customer Invite',
-              href: '/guidelines/workspace-api#cancel-customer-invite',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Customer Signup',
-              href: '/guidelines/workspace-api#customer-signup',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Customer Signup Form',
-              href: '/guidelines/workspace-api#get-customer-signup-form',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Assign Customer to User',
-              href: '/guidelines/workspace-api#assign-customer-to-user',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Share Customer with Users',
-              href: '/guidelines/workspace-api#share-customer-with-users',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Unassign Customer from User',
-              href: '/guidelines/workspace-api#unassign-customer-from-user',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Approve Customer',
-              href: '/guidelines/workspace-api#approve-customer',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Reject Customer',
-              href: '/guidelines/workspace-api#reject-customer',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Add Customer App Access',
-              href: '/guidelines/workspace-api#add-customer-app-access',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Revoke Customer App Access',
-              href: '/guidelines/workspace-api#revoke-customer-app-access',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Put Customer On-Hold',
-              href: '/guidelines/workspace-api#put-customer-on-hold',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Re-Activate Customer',
-              href: '/guidelines/workspace-api#re-activate-customer',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Add Label for Customer Operation',
-              href: '/guidelines/workspace-api#add-label-for-customer-operation',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Enable Bid Shading for Customer',
-              href: '/guidelines/workspace-api#enable-bid-shading-for-customer',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Customer Operations Details',
-              href: '/guidelines/workspace-api#update-customer-operations-details',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            }
-          ]
-        },
-        {
-          type: `category`,
-          label: `Advertiser Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Advertiser Resource Properties',
-              href: '/guidelines/workspace-api#advertiser-management',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Advertiser Profile and Details',
-              href: '/guidelines/workspace-api#get-list-of-advertiser-profile-and-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Add Advertiser Profile',
-              href: '/guidelines/workspace-api#add-advertiser-profile',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Edit Advertiser Profile',
-              href: '/guidelines/workspace-api#edit-advertiser-profile',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Delete Advertiser Profile',
-              href: '/guidelines/workspace-api#delete-advertiser-profile',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Static Details Lists`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Application IDs',
-              href: '/guidelines/workspace-api#application-ids',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Organization Workspace Status',
-              href: '/guidelines/workspace-api#organization-workspace-status',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'User Status',
-              href: '/guidelines/workspace-api#user-status',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Customer Type',
-              href: '/guidelines/workspace-api#customer-type',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Customer Payment Type',
-              href: '/guidelines/workspace-api#customer-payment-type',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Customer Account Type',
-              href: '/guidelines/workspace-api#customer-account-type',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Customer List Sortable Fields',
-              href: '/guidelines/workspace-api#customer-list-sortable-fields',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'User Sort By Options',
-              href: '/guidelines/workspace-api#user-sort-by-options',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Organization Expertise',
-              href: '/guidelines/workspace-api#organization-expertise',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Company Size',
-              href: '/guidelines/workspace-api#company-size',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Industries',
-              href: '/guidelines/workspace-api#industries',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Media Budget',
-              href: '/guidelines/workspace-api#media-budget',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Verticals',
-              href: '/guidelines/workspace-api#verticals',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-      ],
-    },
-    {
-      type: `doc`,
-      label: `OpenAPI Spec`,
-      id: `guidelines/openapi-spec`,
-      className: `sidebarCategory`,
-    }
+    category('Getting Started', 'getting-started/index', [
+      doc('getting-started/platform-overview', 'IQM Platform Overview'),
+      doc('getting-started/rest-api-reference', 'REST API Overview'),
+      doc('getting-started/before-you-begin', 'Before You Begin'),
+      doc('getting-started/typescript-prerequisites', 'TypeScript Prerequisites'),
+      doc('getting-started/api-pagination-guide', 'API Filtering and Pagination'),
+      doc('getting-started/webhooks', 'Webhooks'),
+      doc('getting-started/offline-access', 'Offline Access'),
+    ]),
+    category('Quickstart Guides', 'quickstart-guides/index', [
+      category('Sign Up and Authenticate', 'quickstart-guides/authentication-quickstart-guide', [
+        step('/quickstart-guides/authentication-quickstart-guide#sign-up', 'Sign Up'),
+        step('/quickstart-guides/authentication-quickstart-guide#log-in', 'Log In'),
+        step('/quickstart-guides/authentication-quickstart-guide#refresh-token', 'Refresh Token'),
+      ]),
+      category('Upload a Creative', 'quickstart-guides/upload-a-creative-quickstart', [
+        step('/quickstart-guides/upload-a-creative-quickstart#about-iqm-creatives', 'About IQM Creatives'),
+        step('/quickstart-guides/upload-a-creative-quickstart#before-you-begin', 'Before You Begin'),
+        step('/quickstart-guides/upload-a-creative-quickstart#upload-a-creative-using-the-iqm-api', 'Upload a Creative Using the IQM API'),
+        step('/quickstart-guides/upload-a-creative-quickstart#step-1-log-in', 'Step 1: Log In'),
+        step('/quickstart-guides/upload-a-creative-quickstart#step-2-request-creative-types', 'Step 2: Request Creative Types'),
+        step('/quickstart-guides/upload-a-creative-quickstart#step-3-upload-a-creative', 'Step 3: Upload a Creative'),
+        step('/quickstart-guides/upload-a-creative-quickstart#step-4-check-creative-status', 'Step 4: Check Creative Status'),
+      ]),
+      category('Create a Campaign', 'quickstart-guides/create-a-campaign-quickstart', [
+        step('/quickstart-guides/create-a-campaign-quickstart#about-iqm-campaigns', 'About IQM Creatives'),
+        step('/quickstart-guides/create-a-campaign-quickstart#before-you-begin', 'Before You Begin'),
+        step('/quickstart-guides/create-a-campaign-quickstart#create-a-campaign-using-the-iqm-api', 'Create a Campaign Using the IQM API'),
+        step('/quickstart-guides/create-a-campaign-quickstart#step-1-log-in', 'Step 1: Log in'),
+        step('/quickstart-guides/create-a-campaign-quickstart#step-2-create-insertion-order', 'Step 2: Create an Insertion Order'),
+        step('/quickstart-guides/create-a-campaign-quickstart#step-3-create-a-campaign', 'Step 3: Create a Campaign'),
+        step('/quickstart-guides/create-a-campaign-quickstart#step-4-check-campaign-status', 'Step 4: Check Campaign Status'),
+      ]),
+      category('Create a Contextual Audience', 'quickstart-guides/contextual-audience-quickstart', [
+        step('/quickstart-guides/contextual-audience-quickstart#about-iqm-contextual-audiences', 'About IQM Contextual Audiences'),
+        step('/quickstart-guides/contextual-audience-quickstart#step-1-log-in', 'Step 1: Log In'),
+        step('/quickstart-guides/contextual-audience-quickstart#step-2-create-a-contextual-audience', 'Step 2: Create a Contextual Audience'),
+        step('/quickstart-guides/contextual-audience-quickstart#step-3-check-audience-status', 'Step 3: Check Audience Status'),
+      ]),
+      category('Run a Report', 'quickstart-guides/reporting-api-quickstart-guide', [
+        step('/quickstart-guides/reporting-api-quickstart-guide#about-iqm-reports', 'About IQM Reports'),
+        step('/quickstart-guides/reporting-api-quickstart-guide#run-a-report-using-the-iqm-api', 'Run a Report Using the IQM API'),
+        step('/quickstart-guides/reporting-api-quickstart-guide#step-1-log-in', 'Step 1: Log In'),
+        step('/quickstart-guides/reporting-api-quickstart-guide#step-2-request-dimensions-and-metrics', 'Step 2: Request Dimensions and Metrics'),
+        step('/quickstart-guides/reporting-api-quickstart-guide#step-3-select-timezones', 'Step 3: Select Timezones'),
+        step('/quickstart-guides/reporting-api-quickstart-guide#step-4-execute-a-report', 'Step 4: Execute a Report'),
+        step('/quickstart-guides/reporting-api-quickstart-guide#step-5-optional-export-a-large-report', 'Step 5 (Optional): Export a Large Report'),
+        step('/quickstart-guides/reporting-api-quickstart-guide#faq', 'FAQ'),
+      ]),
+      category('Schedule a Report', 'quickstart-guides/schedule-report-api-quickstart-guide', [
+        step('/quickstart-guides/schedule-report-api-quickstart-guide#about-iqm-reports', 'About IQM Reports'),
+        step('/quickstart-guides/schedule-report-api-quickstart-guide#schedule-a-report-1', 'Schedule a Report'),
+        step('/quickstart-guides/schedule-report-api-quickstart-guide#step-1-log-in', 'Step 1: Log In'),
+        step('/quickstart-guides/schedule-report-api-quickstart-guide#step-2-schedule-a-report', 'Step 2: Schedule a Report'),
+        step('/quickstart-guides/schedule-report-api-quickstart-guide#pull-large-reports-on-a-schedule', 'Pull Large Reports on a Schedule'),
+      ]),
+    ]),
+    category('Tutorials', 'tutorials/index', [
+      category('Create a Bid Model', 'quickstart-guides/bid-model-quickstart', [
+        step('/tutorials/create-a-bid-model#about-iqm-bid-modeling', 'About IQM Bid Modeling'),
+        step('/tutorials/create-a-bid-model#before-you-begin', 'Before You Begin'),
+        step('/tutorials/create-a-bid-model#bid-modeling-criteria', 'Bid Modeling Criteria'),
+        step('/tutorials/create-a-bid-model#step-1-check-campaign-for-eligibility', 'Step 1: Check Campaign for Eligibility'),
+        step('/tutorials/create-a-bid-model#step-2-select-dimension', 'Step 2: Select Dimension'),
+        step('/tutorials/create-a-bid-model#step-3-create-a-bid-model', 'Step 3: Create a Bid Model'),
+      ]),
+      category('Create a Conversion', 'quickstart-guides/conversion-quickstart', [
+        step('/tutorials/create-a-conversion#about-iqm-conversions', 'About IQM Conversions'),
+        step('/tutorials/create-a-conversion#create-a-conversion-using-the-iqm-api', 'Create a Conversion'),
+        step('/tutorials/create-a-conversion#step-1-log-in', 'Step 1: Log In'),
+        step('/tutorials/create-a-conversion#step-2-create-a-pixel-conversion', 'Step 2: Create a Pixel Conversion'),
+        step('/tutorials/create-a-conversion#step-3-assign-a-conversion-to-a-campaign', 'Step 3: Assign a Conversion to a Campaign'),
+      ]),
+      category('Create a Deal', 'tutorials/deal-guide', [
+        step('/tutorials/deal-guide#about-iqm-deals', 'About IQM Deals'),
+        step('/tutorials/deal-guide#before-you-begin', 'Before You Begin'),
+        step('/tutorials/deal-guide#request-exchange-list', 'Request Exchange List'),
+        step('/tutorials/deal-guide#create-a-pg-deal', 'Create a PG Deal'),
+        step('/tutorials/deal-guide#create-a-pmp-deal', 'Create a PMP Deal'),
+        step('/tutorials/deal-guide#assign-deals-to-a-campaign', 'Assign Deals to Campaign'),
+        step('/tutorials/deal-guide#get-list-of-deals-associated-with-campaigns', 'List of Deals and Campaigns'),
+      ]),
+      category('Create an Insights Report', 'quickstart-guides/insights-quickstart', [
+        step('/tutorials/create-an-insights-report#about-iqm-insights', 'About IQM Insights'),
+        step('/tutorials/create-an-insights-report#before-you-begin', 'Before You Begin'),
+        step('/tutorials/create-an-insights-report#eligibility-requirements', 'Eligibility Requirements'),
+        step('/tutorials/create-an-insights-report#campaign-bidding-insights', 'Campaign Bidding Insights'),
+        step('/tutorials/create-an-insights-report#audience-insights-report', 'Audience Insights Report'),
+        step('/tutorials/create-an-insights-report#voter-level-data-report', 'Voter Level Data Report'),
+        step('/tutorials/create-an-insights-report#provider-level-data-report', 'Provider Level Data Report'),
+      ]),
+      category('Create a PG Campaign', 'quickstart-guides/upload-creative-and-create-a-campaign-api-quickstart-guide', [
+        step('/tutorials/create-a-pg-campaign#about-iqm-pg-campaigns', 'About IQM PG Campaigns'),
+        step('/tutorials/create-a-pg-campaign#before-you-begin', 'Before You Begin'),
+        step('/tutorials/create-a-pg-campaign#create-a-pg-campaign-using-the-iqm-api', 'Create a PG Campaign Using the IQM API'),
+        step('/tutorials/create-a-pg-campaign#step-1-log-in', 'Step 1: Log in'),
+        step('/tutorials/create-a-pg-campaign#step-2-create-a-pg-campaign', 'Step 2: Create a PG Campaign'),
+      ]),
+      category('Optimize Your Inventory', 'quickstart-guides/inventory-quickstart', [
+        step('/tutorials/optimize-your-inventory#about-iqm-inventory', 'About IQM Inventory'),
+        step('/tutorials/optimize-your-inventory#optimize-your-inventory-using-the-iqm-api', 'Optimize Your Inventory'),
+        step('/tutorials/optimize-your-inventory#step-1-log-in', 'Step 1: Log In'),
+        step('/tutorials/optimize-your-inventory#step-2-search-inventory-list', 'Step 2: Search Inventory List '),
+        step('/tutorials/optimize-your-inventory#step-3-create-an-inventory-group', 'Step 3: Create an Inventory Group'),
+        step('/tutorials/optimize-your-inventory#step-4-update-an-inventory-group', 'Step 4: Update an Inventory Group'),
+        step('/tutorials/optimize-your-inventory#step-5-campaign-inventory-group-targeting', 'Step 5: Campaign Inventory Group Targeting'),
+        step('/tutorials/optimize-your-inventory#step-6-get-list-of-campaigns-by-group', 'Step 6: Get List of Campaigns by Group'),
+      ]),
+      category('Sign Up a New Customer', 'tutorials/customer-guide', [
+        step('/tutorials/customer-guide#about-iqm-customers', 'About IQM Customers'),
+        step('/tutorials/customer-guide#before-you-begin', 'Before You Begin'),
+        step('/tutorials/customer-guide#sign-up-a-new-customer-using-the-iqm-api', 'Sign Up a New Customer Using the IQM API'),
+        step('/tutorials/customer-guide#invite-a-customer', 'Invite a Customer'),
+        step('/tutorials/customer-guide#sign-up-a-customer', 'Sign Up a Customer'),
+        step('/tutorials/customer-guide#approve-a-customer', 'Approve a Customer'),
+        step('/tutorials/customer-guide#assign-customer-to-user', 'Assign Customer to User'),
+        step('/tutorials/customer-guide#add-customer-app-access', 'Add Customer App Access'),
+        step('/tutorials/customer-guide#add-payment-for-customer', 'Add Payment for Customer'),
+      ]),
+      category('Upload a Matched Audience', 'quickstart-guides/matched-audience-upload-api-quickstart-guide', [
+        step('/tutorials/upload-a-matched-audience#about-iqm-matched-audience', 'About IQM Matched Audience'),
+        step('/tutorials/upload-a-matched-audience#before-you-begin', 'Before You Begin'),
+        step('/tutorials/upload-a-matched-audience#upload-matched-audience-using-the-iqm-api', 'Upload Matched Audience Using the IQM API'),
+        step('/tutorials/upload-a-matched-audience#step-1-log-in', 'Step 1: Log In'),
+        step('/tutorials/upload-a-matched-audience#step-2-request-column-list', 'Step 2: Request Column List'),
+        step('/tutorials/upload-a-matched-audience#step-3-upload-matched-audience', 'Step 3: Upload Matched Audience'),
+        step('/tutorials/upload-a-matched-audience#step-4-check-audience-status', 'Step 4: Check Audience Status'),
+      ]),
+    ]),
+    doc('guidelines/index', 'API Guidelines'),
+    category('Assets API', 'guidelines/asset-api', [
+      category('Assets Details', null, endpoints('/guidelines/asset-api', 'assets-details')),
+      category('Assets Management', null, endpoints('/guidelines/asset-api', 'assets-management')),
+    ]),
+    category('Audience API', 'guidelines/audience-api', [
+      category('Audience Details', null, endpoints('/guidelines/audience-api', 'audience-details')),
+      category('Audience Management', null, endpoints('/guidelines/audience-api', 'audience-management')),
+      category('Matched Audiences', null, [
+        endpoint('/guidelines/audience-api#matched-audience-details'),
+        endpoint('/guidelines/audience-api#create-matched-audience'),
+        endpoint('/guidelines/audience-api#update-matched-audience'),
+        endpoint('/healthcare-vertical/audience-healthcare#refresh-matched-audience'),
+        endpoint('/guidelines/audience-api#data-partners-list-for-matched-audience'),
+        endpoint('/guidelines/audience-api#data-formats-list-for-matched-audience'),
+        endpoint('/guidelines/audience-api#matched-column-list'),
+        endpoint('/guidelines/audience-api#matched-column-combinations'),
+        endpoint('/guidelines/audience-api#download-matched-audience-file'),
+      ]),
+      category('Segmented Audiences', null, endpoints('/guidelines/audience-api', 'segmented-audiences')),
+      category('Retargeted Audiences', null, endpoints('/guidelines/audience-api', 'retargeted-audiences')),
+      category('Geofarmed Audiences', null, endpoints('/guidelines/audience-api', 'geofarmed-audiences')),
+      category('Contextual Audiences', null, endpoints('/guidelines/audience-api', 'contextual-audiences')),
+      category('Lookalike Audiences', null, endpoints('/guidelines/audience-api', 'lookalike-audiences')),
+      category('Campaign Audiences', null, endpoints('/guidelines/audience-api', 'campaign-audiences')),
+      category('Pre-bid Audiences', null, endpoints('/guidelines/audience-api', 'pre-bid-audiences')),
+      category('More Audience Details', null, endpoints('/guidelines/audience-api', 'more-audience-details')),
+    ]),
+    category('Bid Model API', 'guidelines/bid-model-api', [
+      category('Bid Model Details', null, endpoints('/guidelines/bid-model-api', 'bid-modeling-details')),
+      category('Include/Exclude Management', null, [
+        endpoint('/guidelines/bid-model-api#includeexclude-management', 'Devices, Exchanges, Traffic', 'POST'),
+        endpoint('/guidelines/bid-model-api#includeexclude-entities-from-a-campaign'),
+      ]),
+      category('Bid Model Management', null, endpoints('/guidelines/bid-model-api', 'bid-modeling-management')),
+      category('Bid Model Metrics and Dimensions', null, endpoints('/guidelines/bid-model-api', 'bid-model-metrics-and-dimensions')),
+    ]),
+    category('Campaign API', 'guidelines/campaign-api', [
+      category('Campaign Details', null, [
+        link('/guidelines/campaign-api#campaign-resource-properties', 'Campaign Resource Details'),
+        endpoint('/guidelines/campaign-api#get-campaign-details-by-id'),
+        endpoint('/guidelines/campaign-api#get-list-of-campaigns'),
+        endpoint('/guidelines/campaign-api#get-list-of-campaigns-with-basic-details'),
+        endpoint('/guidelines/campaign-api#get-basic-details-of-campaigns'),
+        endpoint('/guidelines/campaign-api#get-campaign-audience-targeting-details'),
+        endpoint('/guidelines/campaign-api#get-list-of-campaigns-with-filters'),
+        endpoint('/guidelines/campaign-api#get-campaign-budget-details'),
+        endpoint('/guidelines/campaign-api#get-list-of-campaign-groups'),
+        endpoint('/guidelines/campaign-api#get-deals-associated-with-campaigns'),
+        endpoint('/guidelines/campaign-api#get-campaign-count-by-status'),
+        endpoint('/guidelines/campaign-api#get-campaign-count-with-campaign-type'),
+        endpoint('/guidelines/campaign-api#get-campaign-count-by-creative-type'),
+        endpoint('/guidelines/campaign-api#get-creative-type-and-campaigns-count'),
+        endpoint('/guidelines/campaign-api#get-campaign-conversion-list'),
+        endpoint('/guidelines/campaign-api#get-basic-conversion-list'),
+        endpoint('/guidelines/campaign-api#get-campaign-start-date'),
+        endpoint('/guidelines/Campaign-API-guidelines/#get-list-of-campaign-start-dates-or-end-dates', 'List of Campaign Start/End Dates', 'POST'),
+        endpoint('/guidelines/campaign-api#get-campaign-report-data'),
+      ]),
+      category('Campaign Management', null, endpoints('/guidelines/campaign-api', 'campaign-management')),
+      category('Campaign Templates', null, endpoints('/guidelines/campaign-api', 'campaign-templates')),
+      category('Campaign Targeting', null, endpoints('/guidelines/campaign-api', 'campaign-targeting')),
+      category('Insertion Order Details', null, endpoints('/guidelines/campaign-api', 'insertion-order-details')),
+      category('Insertion Order Management', null, endpoints('/guidelines/campaign-api', 'insertion-order-management')),
+      category('Get More Details', null, endpoints('/guidelines/campaign-api', 'get-more-details')),
+    ]),
+    category('Conversions API', 'guidelines/conversion-api', [
+      category('Conversion Details', null, endpoints('/guidelines/conversion-api', 'get-conversion-details')),
+      category('Conversions Management', null, endpoints('/guidelines/conversion-api', 'conversions-management')),
+      category('More Conversion Details', null, [
+        endpoint('/guidelines/conversion-api#get-list-of-partner-types-for-postback-conversions'),
+        endpoint('/guidelines/conversion-api#get-list-of-pixel-conversion-advanced-setting-default-values'),
+        endpoint('/guidelines/conversion-api#get-list-of-conversion-types'),
+        endpoint('/guidelines/conversion-api#get-list-of-conversion-status'),
+        endpoint('/guidelines/conversion-api#get-list-of-conversion-piggyback-types'),
+        endpoint('/guidelines/conversion-api/#get-list-of-conversion-property-types'),
+      ]),
+    ]),
+    category('Creative API', 'guidelines/creative-api', [
+      category('Creative Details', null, endpoints('/guidelines/creative-api', 'creative-details')),
+      category('Creative Management', null, endpoints('/guidelines/creative-api', 'creative-management')),
+      category('More Creative Details', null, endpoints('/guidelines/creative-api', 'more-creative-details')),
+    ]),
+    category('Dashboard API', 'guidelines/dashboard-api', [
+      category('Dashboard Details', null, [
+        endpoint('/guidelines/dashboard-api#dashboard-list'),
+        endpoint('/guidelines/dashboard-api#get-campaign-goal-ai-graph-data'),
+        endpoint('/guidelines/dashboard-api#get-campaign-goal-ai-optimization-activity'),
+      ]),
+      category('Dashboard Management', null, endpoints('/guidelines/dashboard-api', 'dashboard-management')),
+      category('Dashboard Reports', null, endpoints('/guidelines/dashboard-api', 'dashboard-reports')),
+    ]),
+    category('Finance API', 'guidelines/finance-api', [
+      category('Finance Details', null, [
+        endpoint('/guidelines/finance-api#finance-details', 'Customer Finance Details', 'GET'),
+        endpoint('/guidelines/finance-api#get-customer-margin-details'),
+        endpoint('/guidelines/finance-api#update-customer-margin-details'),
+        endpoint('/guidelines/finance-api#get-organization-margin-settings'),
+        endpoint('/guidelines/finance-api#update-organization-margin-settings'),
+        endpoint('/guidelines/finance-api#campaign-margin-details'),
+        endpoint('/guidelines/finance-api#get-customer-pg-fees-details'),
+        endpoint('#edit-customer-pg-fees', 'Edit Customer PG Fees', 'PATCH'),
+        endpoint('/guidelines/finance-api/#get-customer-insights-fees-details'),
+        endpoint('/guidelines/finance-api/#update-customer-insights-fees-details'),
+        endpoint('/guidelines/finance-api#get-customer-doubleverify-details'),
+        endpoint('/guidelines/finance-api#update-customer-doubleverify'),
+        endpoint('/guidelines/finance-api#get-basic-financial-details'),
+        endpoint('/guidelines/finance-api#available-balance'),
+        endpoint('/guidelines/finance-api#add-ad-serving-cost'),
+        endpoint('/guidelines/finance-api#get-ad-serving-cost'),
+        endpoint('/guidelines/finance-api#add-or-update-third-party-cost'),
+        endpoint('/guidelines/finance-api#get-third-party-cost'),
+        endpoint('/guidelines/finance-api#disable-third-party-cost'),
+      ]),
+      category('Invoice Management', null, endpoints('/guidelines/finance-api', 'invoice-management')),
+      category('Credit Management', null, endpoints('/guidelines/finance-api', 'credit-management')),
+      category('Payment Management', null, endpoints('/guidelines/finance-api', 'payment-management')),
+      category('Static Details Lists', null, [
+        endpoint('/guidelines/finance-api#static-details-lists', 'Payment Types', 'GET'),
+        endpoint('/guidelines/finance-api#payment-status'),
+        endpoint('/guidelines/finance-api#invoice-payment-mode-types'),
+        endpoint('/guidelines/finance-api#invoice-status'),
+        endpoint('/guidelines/finance-api#invoice-payment-term'),
+        endpoint('/guidelines/finance-api#pg-payment-type'),
+      ]),
+    ]),
+    category('Insights API', 'guidelines/insights-api', [
+      category('Insights Details', null, [
+        endpoint('/guidelines/insights-api#get-insights-details', 'List of Insights', 'GET'),
+        endpoint('/guidelines/insights-api#get-campaign-bidding-insights'),
+        endpoint('/guidelines/insights-api#get-insights-count-by-type'),
+        endpoint('/guidelines/insights-api#get-eligible-campaigns'),
+        endpoint('/guidelines/insights-api#calculate-insights-computation'),
+      ]),
+      category('Insights Management', null, endpoints('/guidelines/insights-api', 'insights-management')),
+      category('Audience Insights', null, endpoints('/guidelines/insights-api', 'audience-insights')),
+      category('Audience Quality Score Reports', null, endpoints('/guidelines/insights-api', 'audience-quality-score-reports')),
+      category('Voter Level Data Reports', null, [
+        link('/guidelines/insights-api#vld-eligibility-requirements', 'VLD Eligibility Requirements'),
+        link('/guidelines/insights-api#voter-level-data-reports', 'VLD Resource Properties'),
+        endpoint('/guidelines/insights-api#get-list-of-vld-reports'),
+        endpoint('/guidelines/insights-api#get-list-of-campaigns-eligible-for-vld-reports'),
+        endpoint('/guidelines/insights-api#generate-vld-report'),
+        endpoint('/guidelines/insights-api#get-cost-assessment-for-vld-report'),
+        endpoint('/guidelines/insights-api#download-vld-insight-report'),
+        endpoint('/guidelines/insights-api#delete-vld-report'),
+      ]),
+      category('ScriptLift Studies Reports', null, endpoints('/guidelines/insights-api', 'scriptlift-studies-reports')),
+      category('Report Templates', null, endpoints('/guidelines/insights-api', 'report-templates')),
+      category('Report Management', null, endpoints('/guidelines/insights-api', 'report-management')),
+      category('More Insights Details', null, [
+        endpoint('/guidelines/insights-api#get-more-insights-details', 'List of Insights Types', 'GET'),
+        endpoint('/guidelines/insights-api#get-list-of-insights-status'),
+        endpoint('/guidelines/insights-api#get-list-of-template-statuses'),
+        endpoint('/guidelines/insights-api#get-scheduling-frequencies'),
+      ]),
+    ]),
+    category('Inventory API', 'guidelines/inventory-api', [
+      category('Inventory Details', null, [
+        link('/guidelines/inventory-api#get-inventory-details', 'Query Parameters'),
+        endpoint('/guidelines/inventory-api#get-list-of-inventories'),
+        endpoint('/guidelines/inventory-api#get-inventory-distribution'),
+        endpoint('/guidelines/inventory-api#get-inventories-count'),
+        endpoint('/guidelines/inventory-api#get-inventory-group-types'),
+        endpoint('/guidelines/inventory-api#get-list-of-blocked-inventories'),
+      ]),
+      category('Inventory Management', null, endpoints('/guidelines/inventory-api', 'inventory-management')),
+      category('CTV Inventories', null, endpoints('/guidelines/inventory-api', 'ctv-inventories')),
+      category('Inventory Groups', null, [
+        endpoint('/guidelines/inventory-api#inventory-groups', 'List of Inventory Groups', 'GET'),
+        endpoint('/guidelines/inventory-api#get-list-of-shared-group-customer-details'),
+        endpoint('/guidelines/inventory-api#get-list-of-inventory-groups-statistics'),
+        endpoint('/guidelines/inventory-api#get-list-of-pmp-deals-in-an-inventory-group'),
+        endpoint('/guidelines/inventory-api#get-csv-list-of-pmp-deals-in-an-inventory-group'),
+        endpoint('/guidelines/inventory-api#get-list-of-open-exchange-inventories-in-an-inventory-group'),
+        endpoint('/guidelines/inventory-api#get-distributions-of-open-exchange-inventories-in-an-inventory-group'),
+        endpoint('/guidelines/inventory-api#get-count-of-open-exchange-inventories-in-an-inventory-group'),
+        endpoint('/guidelines/inventory-api#get-list-of-contextual-inventories-for-an-inventory-group'),
+        endpoint('/guidelines/inventory-api#get-count-of-contextual-inventories-for-an-inventory-group'),
+        endpoint('/guidelines/inventory-api#get-csv-file-of-contextual-inventories-for-an-inventory-group'),
+        endpoint('/guidelines/inventory-api#contextual-inventory'),
+        endpoint('/guidelines/inventory-api#get-inventory-groups-count'),
+        endpoint('/guidelines/inventory-api#download-open-exchange-inventories-for-group'),
+        endpoint('/guidelines/inventory-api#get-ctv-inventories-for-an-inventory-group'),
+        endpoint('/guidelines/inventory-api#get-ctv-inventories-statistics-for-an-inventory-group'),
+        endpoint('/guidelines/inventory-api#get-ctv-inventories-distributions-for-an-inventory-group'),
+        endpoint('/guidelines/inventory-api#download-ctv-inventories-for-an-inventory-group'),
+      ]),
+      category('Inventory Group Management', null, [
+        endpoint('/guidelines/inventory-api#inventory-group-management', 'Create a New Inventory Group', 'POST'),
+        endpoint('/guidelines/inventory-api#add-or-remove-mappings-to-an-inventory-group'),
+        endpoint('/guidelines/inventory-api#add-or-remove-customers-from-a-shared-inventory-group'),
+        endpoint('/guidelines/inventory-api#edit-inventory-group'),
+        endpoint('/guidelines/inventory-api#delete-inventory-group'),
+        endpoint('/guidelines/inventory-api#add-contextual-inventories-to-group'),
+        endpoint('/guidelines/inventory-api#remove-contextual-inventories-from-group'),
+        endpoint('/guidelines/inventory-api#validate-inventory-group'),
+      ]),
+      category('Deals Details', null, endpoints('/guidelines/inventory-api', 'deals-details')),
+      category('Private Marketplace (PMP) Deals Details', null, endpoints('/guidelines/inventory-api', 'private-marketplace-pmp-deals-details')),
+      category('PMP Management', null, [
+        link('/guidelines/inventory-api#pmp-management', 'Resource Properties'),
+        endpoint('/guidelines/inventory-api#create-pmp-deal'),
+        endpoint('/guidelines/inventory-api#update-pmp-deal'),
+        endpoint('/guidelines/inventory-api#delete-pmp-deal'),
+      ]),
+      category('Programmatic Guaranteed (PG) Deals Details', null, endpoints('/guidelines/inventory-api', 'programmatic-guaranteed-pg-deals-details')),
+      category('PG Management', null, [
+        link('/guidelines/inventory-api#pg-management', 'Resource Properties'),
+        endpoint('/guidelines/inventory-api#create-pg-deal'),
+        endpoint('/guidelines/inventory-api#update-pg-deal-details'),
+        endpoint('/guidelines/inventory-api#delete-pg-deal'),
+      ]),
+    ]),
+    category('Master API', 'guidelines/master-api', [
+      category('Geographical Data', null, endpoints('/guidelines/master-api', 'get-geographical-data')),
+      category('Creative Data', null, [
+        link('/guidelines/master-api#get-creative-data', 'Query Parameters'),
+        endpoint('/guidelines/master-api#get-rtb-creative-types'),
+        endpoint('/guidelines/master-api#get-creative-sizes'),
+        endpoint('/guidelines/master-api#get-video-skip-parameters'),
+        endpoint('/guidelines/master-api#get-video-roll-position-parameters'),
+        endpoint('/guidelines/master-api#get-video-player-size-parameters'),
+        endpoint('/guidelines/master-api#get-video-playback-method-parameters'),
+        endpoint('/guidelines/master-api#get-video-placement-type-parameters'),
+      ]),
+      category('More Data', null, endpoints('/guidelines/master-api', 'get-more-data')),
+    ]),
+    category('Planner API', 'guidelines/planner-api', [
+      category('Proposal Details', null, endpoints('/guidelines/planner-api', 'proposal-details')),
+      category('Proposal Management', null, endpoints('/guidelines/planner-api', 'proposal-management')),
+      category('More Details', null, endpoints('/guidelines/planner-api', 'more-details')),
+    ]),
+    category('Reports API', 'guidelines/reports-api', [
+      category('Reports Details', null, [
+        endpoint('/guidelines/reports-api#get-reports-details', 'List of Reports', 'GET'),
+        endpoint('/guidelines/reports-api#get-report-by-id'),
+      ]),
+      category('Reports Management', null, [
+        link('/guidelines/reports-api#reports-management', 'Resource Properties'),
+        endpoint('/guidelines/reports-api#create-report'),
+        endpoint('/guidelines/reports-api#execute-a-report'),
+        endpoint('/guidelines/reports-api#delete-a-report'),
+        endpoint('/guidelines/reports-api#edit-a-report'),
+        endpoint('/guidelines/reports-api#duplicate-a-report'),
+      ]),
+      category('Scheduling Management', null, [
+        endpoint('/guidelines/reports-api#scheduling-management', 'Schedule a Report', 'POST'),
+        endpoint('/guidelines/reports-api#update-a-report-schedule'),
+        endpoint('/guidelines/reports-api#delete-report-schedule'),
+        endpoint('/guidelines/reports-api#unsubscribe-an-email-from-all-scheduled-reports'),
+        endpoint('/guidelines/reports-api#unsubscribe-an-email-from-a-report-schedule'),
+      ]),
+      category('Get More Report Details', null, [
+        endpoint('/guidelines/reports-api#get-more-report-details', 'URL for Report Download', 'POST'),
+        endpoint('/guidelines/reports-api#get-a-list-of-conversions-custom-fields'),
+        endpoint('/guidelines/reports-api#get-report-request-types'),
+        endpoint('/guidelines/reports-api#get-report-file-types'),
+        endpoint('/guidelines/reports-api#get-report-delivery-frequency-types'),
+        endpoint('/guidelines/reports-api#get-dimensions-and-metrics-details'),
+      ]),
+    ]),
+    category('User Management API', 'guidelines/user-api', [
+      category('Authentication', null, endpoints('/guidelines/user-api', 'authentication-1')),
+      category('User Details', null, endpoints('/guidelines/user-api', 'user-details')),
+      category('User Management', null, endpoints('/guidelines/user-api', 'user-management')),
+      category('User Application Access', null, endpoints('/guidelines/user-api', 'user-application-access')),
+      category('Validations', null, endpoints('/guidelines/user-api/', 'validations')),
+    ]),
+    category('Workspace API', 'guidelines/workspace-api', [
+      category('Organization Details', null, [
+        link('/guidelines/workspace-api#organization-details', 'Resource Properties'),
+        endpoint('/guidelines/workspace-api#get-list-of-allowed-organizations'),
+        endpoint('/guidelines/workspace-api#get-organization-details'),
+        endpoint('/guidelines/workspace-api#check-for-available-domain'),
+        endpoint('/guidelines/workspace-api#organization-applications-list'),
+        endpoint('/guidelines/workspace-api#get-list-of-user-interaction-events'),
+        endpoint('/guidelines/workspace-api#upsert-interaction-event'),
+      ]),
+      category('Organization Management', null, [
+        endpoint('/guidelines/workspace-api#organization-management', 'Update Organization Profile', 'PATCH'),
+        endpoint('/guidelines/workspace-api#update-organization-email'),
+        endpoint('/guidelines/workspace-api#get-list-of-admin-users'),
+      ]),
+      category('Whitelabel Settings', null, endpoints('/guidelines/workspace-api', 'whitelabel-settings')),
+      category('Workspace Management', null, [
+        endpoint('/guidelines/workspace-api#workspace-management', 'Create a Workspace', 'POST'),
+        endpoint('/guidelines/workspace-api#update-workspace-domain'),
+        endpoint('/guidelines/workspace-api#validate-workspace-domain'),
+        endpoint('/guidelines/workspace-api#get-list-of-workspaces'),
+        endpoint('/guidelines/workspace-api#get-workspace-initialization-details'),
+        endpoint('/guidelines/workspace-api#get-workspace-organization-logo'),
+        endpoint('/guidelines/workspace-api#get-workspace-chatbot-app-id'),
+        endpoint('/guidelines/workspace-api#get-workspace-chatbot-app-id-by-domain'),
+        endpoint('/guidelines/workspace-api#send-find-my-workspace-email'),
+      ]),
+      category('Customer Details', null, [
+        link('/guidelines/workspace-api#customer-details', 'Customer Resource Properties'),
+        link('/guidelines/workspace-api#customer-operations-resource-properties', 'Customer Operations Resource Properties'),
+        endpoint('/guidelines/workspace-api#get-customer-details'),
+        endpoint('/guidelines/workspace-api#get-basic-customer-details'),
+        endpoint('/guidelines/workspace-api#get-multi-level-customers-list'),
+        endpoint('/guidelines/workspace-api#get-immediate-customers-list'),
+        endpoint('/guidelines/workspace-api#get-customer-operations-details'),
+        endpoint('/guidelines/workspace-api#get-customer-operations-label-list'),
+        endpoint('/guidelines/workspace-api#get-count-of-customers-by-status'),
+        endpoint('/guidelines/workspace-api#get-list-of-users-for-selected-customer'),
+        endpoint('/guidelines/workspace-api#get-list-of-user-assigned-customers'),
+        endpoint('/guidelines/workspace-api#get-users-remaining-customers'),
+        endpoint('/guidelines/workspace-api#get-list-of-customers-allowed-applications'),
+        endpoint('/guidelines/workspace-api#get-allowed-customer-ow-ids'),
+        endpoint('/guidelines/workspace-api#get-list-of-remaining-apps-for-customer'),
+        endpoint('/guidelines/workspace-api#get-remaining-applications-for-user'),
+        endpoint('/guidelines/workspace-api#get-metabase-client-credentials'),
+        endpoint('/guidelines/workspace-api#get-list-of-advertisers-for-customer'),
+        endpoint('/guidelines/workspace-api#get-customer-config-details'),
+      ]),
+      category('Customer Management', null, [
+        endpoint('/guidelines/workspace-api#invitation-pre-requisite-details'),
+        endpoint('/guidelines/workspace-api#customer-management', 'Invite Customer to Platform', 'POST'),
+        endpoint('/guidelines/workspace-api#resend-customer-invite'),
+        endpoint('/guidelines/workspace-api#cancel-customer-invite'),
+        endpoint('/guidelines/workspace-api#customer-signup'),
+        endpoint('/guidelines/workspace-api#get-customer-signup-form'),
+        endpoint('/guidelines/workspace-api#assign-customer-to-user'),
+        endpoint('/guidelines/workspace-api#share-customer-with-users'),
+        endpoint('/guidelines/workspace-api#unassign-customer-from-user'),
+        endpoint('/guidelines/workspace-api#approve-customer'),
+        endpoint('/guidelines/workspace-api#reject-customer'),
+        endpoint('/guidelines/workspace-api#add-customer-app-access'),
+        endpoint('/guidelines/workspace-api#revoke-customer-app-access'),
+        endpoint('/guidelines/workspace-api#put-customer-on-hold'),
+        endpoint('/guidelines/workspace-api#re-activate-customer'),
+        endpoint('/guidelines/workspace-api#add-label-for-customer-operation'),
+        endpoint('/guidelines/workspace-api#enable-bid-shading-for-customer'),
+        endpoint('/guidelines/workspace-api#update-customer-operations-details'),
+      ]),
+      category('Advertiser Management', null, [
+        link('/guidelines/workspace-api#advertiser-management', 'Advertiser Resource Properties'),
+        endpoint('/guidelines/workspace-api#get-list-of-advertiser-profile-and-details'),
+        endpoint('/guidelines/workspace-api#add-advertiser-profile'),
+        endpoint('/guidelines/workspace-api#edit-advertiser-profile'),
+        endpoint('/guidelines/workspace-api#delete-advertiser-profile'),
+      ]),
+      category('Static Details Lists', null, endpoints('/guidelines/workspace-api', 'static-details-lists')),
+    ]),
+    doc('guidelines/openapi-spec', 'OpenAPI Spec'),
+    doc('guidelines/field-lookup', 'Field Lookup'),
   ],
   migrationSidebar: [
-    {
-      type: "category",
-      label: 'Migration Guides',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'migration-guides/index'
-      },
-      items: [
-        {
-          type: 'category',
-          label: 'Beeswax Migration Guide',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: `doc`,
-              label: 'Overview',
-              id: `migration-guides/beeswax/overview`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Audience',
-              id: `migration-guides/beeswax/audience-migration`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Campaigns',
-              id: `migration-guides/beeswax/campaign-migration-guide`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Bid Model',
-              id: `migration-guides/beeswax/bid-model-migration`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Conversions',
-              id: `migration-guides/beeswax/conversions-migration`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Inventories',
-              id: `migration-guides/beeswax/inventories-migration`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Reports',
-              id: `migration-guides/beeswax/reports-migration`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Workspace',
-              id: `migration-guides/beeswax/workspace-migration`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Finances',
-              id: `migration-guides/beeswax/finance-migration`,
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'DV360 Migration Guide',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: `doc`,
-              label: 'Overview',
-              id: `migration-guides/dv360/overview`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Audience',
-              id: `migration-guides/dv360/audience-migration`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Campaigns',
-              id: `migration-guides/dv360/campaign-migration`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Bid Model',
-              id: `migration-guides/dv360/bid-model-migration`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Conversions',
-              id: `migration-guides/dv360/conversions-migration`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Inventories',
-              id: `migration-guides/dv360/inventories-migration`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Reports',
-              id: `migration-guides/dv360/reports-migration`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Workspace',
-              id: `migration-guides/dv360/workspace-migration`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Finances',
-              id: `migration-guides/dv360/finance-migration`,
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'The Trade Desk Migration Guide',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: `doc`,
-              label: 'Overview',
-              id: `migration-guides/the-trade-desk/overview`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Audiences',
-              id: `migration-guides/the-trade-desk/audience-migration-guide`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Campaigns',
-              id: `migration-guides/the-trade-desk/campaign-migration-guide`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Bid Model',
-              id: `migration-guides/the-trade-desk/bid-model-migration-guide`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Conversions',
-              id: `migration-guides/the-trade-desk/conversions-migration-guide`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Inventories',
-              id: `migration-guides/the-trade-desk/inventories-migration-guide`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Reports',
-              id: `migration-guides/the-trade-desk/reports-migration-guide`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Workspace',
-              id: `migration-guides/the-trade-desk/workspace-migration`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Finances',
-              id: `migration-guides/the-trade-desk/finance-migration`,
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Xandr Migration',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: `doc`,
-              label: 'Overview',
-              id: `migration-guides/xandr/overview`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Audience',
-              id: `migration-guides/xandr/audience-migration`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Campaigns',
-              id: `migration-guides/xandr/campaign-migration`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Bid Model',
-              id: `migration-guides/xandr/bid-model-migration`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Conversions',
-              id: `migration-guides/xandr/conversions-migration`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Inventories',
-              id: `migration-guides/xandr/inventories-migration`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Reports',
-              id: `migration-guides/xandr/reports-migration`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Workspace',
-              id: `migration-guides/xandr/workspace-migration`,
-              className: 'sidebarItem'
-            },
-            {
-              type: `doc`,
-              label: 'Finances',
-              id: `migration-guides/xandr/finance-migration`,
-              className: 'sidebarItem'
-            },
-          ]
-        }
-      ],
-    },
+    category('Migration Guides', 'migration-guides/index', [
+      category('Beeswax Migration Guide', null, [
+        doc('migration-guides/beeswax/overview', 'Overview'),
+        doc('migration-guides/beeswax/audience-migration', 'Audience'),
+        doc('migration-guides/beeswax/campaign-migration-guide', 'Campaigns'),
+        doc('migration-guides/beeswax/bid-model-migration', 'Bid Model'),
+        doc('migration-guides/beeswax/conversions-migration', 'Conversions'),
+        doc('migration-guides/beeswax/inventories-migration', 'Inventories'),
+        doc('migration-guides/beeswax/reports-migration', 'Reports'),
+        doc('migration-guides/beeswax/workspace-migration', 'Workspace'),
+        doc('migration-guides/beeswax/finance-migration', 'Finances'),
+      ]),
+      category('DV360 Migration Guide', null, [
+        doc('migration-guides/dv360/overview', 'Overview'),
+        doc('migration-guides/dv360/audience-migration', 'Audience'),
+        doc('migration-guides/dv360/campaign-migration', 'Campaigns'),
+        doc('migration-guides/dv360/bid-model-migration', 'Bid Model'),
+        doc('migration-guides/dv360/conversions-migration', 'Conversions'),
+        doc('migration-guides/dv360/inventories-migration', 'Inventories'),
+        doc('migration-guides/dv360/reports-migration', 'Reports'),
+        doc('migration-guides/dv360/workspace-migration', 'Workspace'),
+        doc('migration-guides/dv360/finance-migration', 'Finances'),
+      ]),
+      category('The Trade Desk Migration Guide', null, [
+        doc('migration-guides/the-trade-desk/overview', 'Overview'),
+        doc('migration-guides/the-trade-desk/audience-migration-guide', 'Audiences'),
+        doc('migration-guides/the-trade-desk/campaign-migration-guide', 'Campaigns'),
+        doc('migration-guides/the-trade-desk/bid-model-migration-guide', 'Bid Model'),
+        doc('migration-guides/the-trade-desk/conversions-migration-guide', 'Conversions'),
+        doc('migration-guides/the-trade-desk/inventories-migration-guide', 'Inventories'),
+        doc('migration-guides/the-trade-desk/reports-migration-guide', 'Reports'),
+        doc('migration-guides/the-trade-desk/workspace-migration', 'Workspace'),
+        doc('migration-guides/the-trade-desk/finance-migration', 'Finances'),
+      ]),
+      category('Xandr Migration', null, [
+        doc('migration-guides/xandr/overview', 'Overview'),
+        doc('migration-guides/xandr/audience-migration', 'Audience'),
+        doc('migration-guides/xandr/campaign-migration', 'Campaigns'),
+        doc('migration-guides/xandr/bid-model-migration', 'Bid Model'),
+        doc('migration-guides/xandr/conversions-migration', 'Conversions'),
+        doc('migration-guides/xandr/inventories-migration', 'Inventories'),
+        doc('migration-guides/xandr/reports-migration', 'Reports'),
+        doc('migration-guides/xandr/workspace-migration', 'Workspace'),
+        doc('migration-guides/xandr/finance-migration', 'Finances'),
+      ]),
+    ]),
   ],
   politicalSidebar: [
-    {
-      type: 'doc',
-      id: 'political-vertical/index',
-      label: 'Political',
-      className: 'sidebarCategory'
-    },
-    {
-      type: 'category',
-      label: 'Audience API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'political-vertical/audience-segments'
-      },
-      items: [
-        {
-          type: 'category',
-          label: 'Audience Details',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Audience Details List',
-              href: '/political-vertical/audience-segments#audience-details-list',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Basic Audience Details',
-              href: '/political-vertical/audience-segments#basic-audience-details',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Audience Count by Status',
-              href: '/political-vertical/audience-segments#audience-count-by-status',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Audience Count by Type',
-              href: '/political-vertical/audience-segments#audience-count-by-type',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Audience Count by Data Partner',
-              href: '/political-vertical/audience-segments#audience-count-by-data-partner',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Matched Audience',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Matched Audience Details',
-              href: '/political-vertical/audience-segments#matched-audience-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Create Matched Audience',
-              href: '/political-vertical/audience-segments#create-matched-audience',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Update Matched Audience',
-              href: '/political-vertical/audience-segments#update-matched-audience',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Refresh Matched Audience',
-              href: '/healthcare-vertical/audience-healthcare#refresh-matched-audience',
-              customProps: { method: 'PUT' },
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Geofarmed Audience',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Geofarmed Audience Details',
-              href: '/political-vertical/audience-segments#geofarmed-audience-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Create Geofarmed Audience',
-              href: '/political-vertical/audience-segments#create-geofarmed-audience',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Segmented Audience',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Segmented Audience Details',
-              href: '/political-vertical/audience-segments#segmented-audience-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Search Segmented Audiences',
-              href: '/political-vertical/audience-segments#search-segmented-audiences',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Create Segmented Audience',
-              href: '/political-vertical/audience-segments#create-segmented-audience',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Update Segmented Audience',
-              href: '/political-vertical/audience-segments#update-segmented-audience',
-              customProps: { method: 'PUT' },
-              className: 'sidebarItem',
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Contextual Audience',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Contextual Audience Details',
-              href: '/political-vertical/audience-segments#contextual-audience-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Create Contextual Audience',
-              href: '/political-vertical/audience-segments#create-contextual-audience',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Custom Voter Audience',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Custom Voter Audience Details',
-              href: '/political-vertical/audience-segments#get-custom-voter-audience-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Available States for Custom Voter Audiences',
-              href: '/political-vertical/audience-segments#get-available-states-for-custom-voter-audiences',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Custom Voter Audience Segment Details',
-              href: '/political-vertical/audience-segments#get-custom-voter-audience-segment-details',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Create Custom Voter Audience',
-              href: '/political-vertical/audience-segments#create-custom-voter-audience',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Get CVA Reach',
-              href: '/political-vertical/audience-segments#get-cva-reach',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Get CVA Insights',
-              href: '/political-vertical/audience-segments#get-cva-insights',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            }
-          ]
-        },
-        {
-          type: 'category',
-          label: 'More Audience Details',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Matched Data Partners',
-              href: '/political-vertical/audience-segments#data-partners-list-for-matched-audience',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Segmented Reach Range',
-              href: '/political-vertical/audience-segments#reach-range-list-for-segmented-audiences',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Segmented Price Range',
-              href: '/political-vertical/audience-segments#price-range-list-for-segmented-audiences',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Audience Type List',
-              href: '/political-vertical/audience-segments#audience-type-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Audience Subtype List',
-              href: '/political-vertical/audience-segments#audience-subtype-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Audience Status List',
-              href: '/political-vertical/audience-segments#audience-status-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Frequency Type List',
-              href: '/political-vertical/audience-segments#frequency-type-list',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            }
-          ]
-        }
-      ]
-    },
-    {
-      type: 'category',
-      label: 'Finance API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'political-vertical/finance'
-      },
-      items: [
-            {
-              type: 'link',
-              label: 'Customer Insights Fees Details',
-              href: '/political-vertical/finance/#get-customer-insights-fees-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Update Customer Insights Fees Details',
-              href: '/political-vertical/finance/#update-customer-insights-fees-details',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem',
-            },
-          ]
-    },
-    {
-      type: 'category',
-      label: 'Insights API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'political-vertical/insights-vld'
-      },
-      items: [
-        {
-          type: `category`,
-          label: `Voter Level Data Reports`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'VLD Eligibility Requirements',
-              href: '/political-vertical/insights-vld/#vld-eligibility-requirements',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'VLD Resource Properties',
-              href: '/political-vertical/insights-vld/#vld-resource-properties',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of VLD Reports',
-              href: '/political-vertical/insights-vld/#get-list-of-vld-reports',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Campaigns Eligible for VLD Reports',
-              href: '/political-vertical/insights-vld/#get-list-of-campaigns-eligible-for-vld-reports',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Generate VLD Report',
-              href: '/political-vertical/insights-vld/#generate-vld-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Cost Assessment for VLD Report',
-              href: '/political-vertical/insights-vld/#get-cost-assessment-for-vld-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Download VLD Insight Report',
-              href: '/political-vertical/insights-vld/#download-vld-insight-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Delete VLD Report',
-              href: '/political-vertical/insights-vld/#delete-vld-report',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-      ],
-    },
-    {
-      type: 'category',
-      label: 'Planner API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'political-vertical/planner'
-      },
-      items: [
-        {
-          type: 'category',
-          label: 'Political Planner Details',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Resource Properties',
-              href: '/political-vertical/planner#political-planner-resource-properties',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Plan Details by ID',
-              href: '/political-vertical/planner#get-plan-details-by-id',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Plans',
-              href: '/political-vertical/planner#get-list-of-political-plans',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Proposals',
-              href: '/political-vertical/planner#get-list-of-proposals',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Proposal Details',
-              href: '/political-vertical/planner#get-proposal-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Download Proposal',
-              href: '/political-vertical/planner#download-proposal',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Proposal Summary',
-              href: '/political-vertical/planner#get-proposal-summary',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Strategies',
-              href: '/political-vertical/planner#get-list-of-strategies',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Strategy Details',
-              href: '/political-vertical/planner#get-strategy-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Estimate Plan Reach',
-              href: '/political-vertical/planner#estimate-plan-reach',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Political Planner Management',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Create Plan',
-              href: '/political-vertical/planner#create-plan',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Edit Plan',
-              href: '/political-vertical/planner#edit-plan',
-              customProps: { method: 'PUT' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Delete Plans',
-              href: '/political-vertical/planner#delete-plans',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Activate Proposal',
-              href: '/political-vertical/planner#activate-proposal',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Edit Proposal',
-              href: '/political-vertical/planner#edit-proposal',
-              customProps: { method: 'PUT' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Generate IO and Campaigns',
-              href: '/political-vertical/planner#generate-io-and-campaigns',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Delete Proposals',
-              href: '/political-vertical/planner#delete-proposals',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Restore Proposals',
-              href: '/political-vertical/planner#restore-proposals',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Create CVA Details',
-              href: '/political-vertical/planner#create-cva-details',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update CVA Details',
-              href: '/political-vertical/planner#update-cva-details',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Generate Custom Strategies',
-              href: '/political-vertical/planner#generate-custom-strategies',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Delete Strategy',
-              href: '/political-vertical/planner#delete-strategy',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'More Political Planner Details',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Supported Parameters',
-              href: '/political-vertical/planner#get-supported-parameters',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Targeting Types',
-              href: '/political-vertical/planner#get-targeting-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Strategy Types',
-              href: '/political-vertical/planner#get-strategy-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Split Types',
-              href: '/political-vertical/planner#get-split-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Plan Statuses',
-              href: '/political-vertical/planner#get-plan-statuses',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Plan Objectives',
-              href: '/political-vertical/planner#get-plan-objectives',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-      ]
-    },
-    {
-      type: 'category',
-      label: 'Master API',
-      className: 'sidebarCategory',
-      items: [
-        {
-          type: 'link',
-          label: 'Overview',
-          href: '/guidelines/master-api',
-          className: 'sidebarItem'
-        },
-        {
-          type: 'category',
-          label: 'Geographical Data',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Request Schema',
-              href: '/guidelines/master-api#request-schema',
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Zip Codes and State IDs',
-              href: '/guidelines/master-api#get-zip-codes-and-state-ids',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'State Segment',
-              href: '/guidelines/master-api#get-state-segment',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Senate District Segment',
-              href: '/guidelines/master-api#get-senate-district-segment',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'House District Segment',
-              href: '/guidelines/master-api#get-house-district-segment',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Gender Segment',
-              href: '/guidelines/master-api#get-gender-segment',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Age Segment',
-              href: '/guidelines/master-api#get-age-segment',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Language Segment',
-              href: '/guidelines/master-api#get-language-segment',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Interest Segment',
-              href: '/guidelines/master-api#get-interest-segment',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Income Range Segment',
-              href: '/guidelines/master-api#get-income-range-segment',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Ethnicity Segment',
-              href: '/guidelines/master-api#get-ethnicity-segment',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Ethnicity Group Segment',
-              href: '/guidelines/master-api#get-ethnicity-group-segment',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'DMA Code Segment',
-              href: '/guidelines/master-api#get-dma-code-segment',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'County Segment',
-              href: '/guidelines/master-api#get-county-segment',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Country Segment',
-              href: '/guidelines/master-api#get-country-segment',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Congressional District Segment',
-              href: '/guidelines/master-api#get-congressional-district-segment',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'City Segment',
-              href: '/guidelines/master-api#get-city-segment',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Location Types',
-              href: '/guidelines/master-api#get-location-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Location Details by Location Type',
-              href: '/guidelines/master-api#get-location-details-by-location-type',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Timezones',
-              href: '/guidelines/master-api#get-timezones',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Carriers and States by Country ID',
-              href: '/guidelines/master-api#get-carriers-and-states-by-country-id',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-      ]
-    }
+    doc('political-vertical/index', 'Political'),
+    category('Audience API', 'political-vertical/audience-segments', [
+      category('Audience Details', null, endpoints('/political-vertical/audience-segments', 'audience-details')),
+      category('Matched Audience', null, [
+        endpoint('/political-vertical/audience-segments#matched-audience-details'),
+        endpoint('/political-vertical/audience-segments#create-matched-audience'),
+        endpoint('/political-vertical/audience-segments#update-matched-audience'),
+        endpoint('/healthcare-vertical/audience-healthcare#refresh-matched-audience'),
+      ]),
+      category('Geofarmed Audience', null, endpoints('/political-vertical/audience-segments', 'geofarmed-audience')),
+      category('Segmented Audience', null, endpoints('/political-vertical/audience-segments', 'segmented-audience')),
+      category('Contextual Audience', null, endpoints('/political-vertical/audience-segments', 'contextual-audience')),
+      category('Custom Voter Audience', null, endpoints('/political-vertical/audience-segments', 'cva-audience')),
+      category('More Audience Details', null, endpoints('/political-vertical/audience-segments', 'more-audience-details')),
+    ]),
+    category('Finance API', 'political-vertical/finance', endpoints('/political-vertical/finance/', 'finance-details')),
+    category('Insights API', 'political-vertical/insights-vld', [
+      category('Voter Level Data Reports', null, endpoints('/political-vertical/insights-vld/', 'voter-level-data-reports')),
+    ]),
+    category('Planner API', 'political-vertical/planner', [
+      category('Political Planner Details', null, endpoints('/political-vertical/planner', 'political-proposal-planner-details')),
+      category('Political Planner Management', null, endpoints('/political-vertical/planner', 'political-proposal-planner-management')),
+      category('More Political Planner Details', null, endpoints('/political-vertical/planner', 'more-political-planner-details')),
+    ]),
+    category('Master API', null, [
+      link('/guidelines/master-api', 'Overview'),
+      category('Geographical Data', null, [
+        link('/guidelines/master-api#request-schema', 'Request Schema'),
+        endpoint('/guidelines/master-api#get-zip-codes-and-state-ids'),
+        endpoint('/guidelines/master-api#get-state-segment'),
+        endpoint('/guidelines/master-api#get-senate-district-segment'),
+        endpoint('/guidelines/master-api#get-house-district-segment'),
+        endpoint('/guidelines/master-api#get-gender-segment'),
+        endpoint('/guidelines/master-api#get-age-segment'),
+        endpoint('/guidelines/master-api#get-language-segment'),
+        endpoint('/guidelines/master-api#get-interest-segment'),
+        endpoint('/guidelines/master-api#get-income-range-segment'),
+        endpoint('/guidelines/master-api#get-ethnicity-segment'),
+        endpoint('/guidelines/master-api#get-ethnicity-group-segment'),
+        endpoint('/guidelines/master-api#get-dma-code-segment'),
+        endpoint('/guidelines/master-api#get-county-segment'),
+        endpoint('/guidelines/master-api#get-country-segment'),
+        endpoint('/guidelines/master-api#get-congressional-district-segment'),
+        endpoint('/guidelines/master-api#get-city-segment'),
+        endpoint('/guidelines/master-api#get-location-types'),
+        endpoint('/guidelines/master-api#get-location-details-by-location-type'),
+        endpoint('/guidelines/master-api#get-timezones'),
+        endpoint('/guidelines/master-api#get-carriers-and-states-by-country-id'),
+      ]),
+    ]),
   ],
   healthcareSidebar: [
-    {
-      type: 'doc',
-      id: 'healthcare-vertical/index',
-      label: 'Healthcare',
-      className: 'sidebarCategory'
-    },
-    {
-      type: 'category',
-      label: 'Audience API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'healthcare-vertical/audience-healthcare'
-      },
-      items: [
-        {
-          type: `category`,
-          label: `Audience Details`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Audience Details List',
-              href: '/healthcare-vertical/audience-healthcare#audience-details-list',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Basic Audience Details',
-              href: '/healthcare-vertical/audience-healthcare#basic-audience-details',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Audience Count by Status',
-              href: '/healthcare-vertical/audience-healthcare#audience-count-by-status',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Audience Count by Type',
-              href: '/healthcare-vertical/audience-healthcare#audience-count-by-type',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Audience Count by Data Partner',
-              href: '/healthcare-vertical/audience-healthcare#audience-count-by-data-partner',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Healthcare Data Details`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Healthcare Titles List',
-              href: '/healthcare-vertical/audience-healthcare#healthcare-titles-list',
-              customProps: { method: 'GET' },
-            },
-            {
-              type: 'link',
-              label: 'Healthcare Specialties List',
-              href: '/healthcare-vertical/audience-healthcare#healthcare-specialties-list',
-              customProps: { method: 'GET' },
-            },
-            {
-              type: 'link',
-              label: 'Healthcare Systems List',
-              href: '/healthcare-vertical/audience-healthcare#healthcare-systems-list',
-              customProps: { method: 'GET' },
-            },
-            {
-              type: 'link',
-              label: 'Healthcare Data',
-              href: '/healthcare-vertical/audience-healthcare#healthcare-data',
-              customProps: { method: 'POST' },
-            },
-            {
-              type: 'link',
-              label: 'Healthcare Statistics',
-              href: '/healthcare-vertical/audience-healthcare#healthcare-statistics',
-              customProps: { method: 'POST' },
-            },
-            {
-              type: 'link',
-              label: 'Healthcare Account Types',
-              href: '/healthcare-vertical/audience-healthcare#healthcare-account-types',
-              customProps: { method: 'POST' },
-            },
-            {
-              type: 'link',
-              label: 'Healthcare Account Subtypes',
-              href: '/healthcare-vertical/audience-healthcare#healthcare-account-subtypes',
-              customProps: { method: 'POST' },
-            },
-            {
-              type: 'link',
-              label: 'Healthcare Account Names',
-              href: '/healthcare-vertical/audience-healthcare#healthcare-account-names',
-              customProps: { method: 'POST' },
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Matched Audiences`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Matched Audience Details',
-              href: '/healthcare-vertical/audience-healthcare#matched-audience-details',
-              customProps: { method: 'GET' },
-            },
-            {
-              type: 'link',
-              label: 'Create Matched Audience',
-              href: '/healthcare-vertical/audience-healthcare#create-matched-audience',
-              customProps: { method: 'POST' },
-            },
-            {
-              type: 'link',
-              label: 'Update Matched Audience',
-              href: '/healthcare-vertical/audience-healthcare#update-matched-audience',
-              customProps: { method: 'PATCH' },
-            },
-            {
-              type: 'link',
-              label: 'Refresh Matched Audience',
-              href: '/healthcare-vertical/audience-healthcare#refresh-matched-audience',
-              customProps: { method: 'PUT' },
-            },
-            {
-              type: 'link',
-              label: 'Matched Data Partners',
-              href: '/healthcare-vertical/audience-healthcare#data-partners-list-for-matched-audience',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `ABM Audiences`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'ABM Audience Details',
-              href: '/healthcare-vertical/audience-healthcare#abm-audience-details',
-              customProps: { method: 'GET' },
-            },
-            {
-              type: 'link',
-              label: 'ABM Audience Statistics',
-              href: '/healthcare-vertical/audience-healthcare#abm-audience-statistics',
-              customProps: { method: 'GET' },
-            },
-            {
-              type: 'link',
-              label: 'Create ABM Audience',
-              href: '/healthcare-vertical/audience-healthcare#create-abm-audience',
-              customProps: { method: 'POST' },
-            },
-            {
-              type: 'link',
-              label: 'Upload ABM Filter File',
-              href: '/healthcare-vertical/audience-healthcare#upload-abm-filter-file',
-              customProps: { method: 'POST' },
-            }
-          ]
-        },
-        {
-          type: `category`,
-          label: `ICT Audiences`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Get ICT Audience Details',
-              href: '/healthcare-vertical/audience-healthcare#get-ict-audience-details',
-              customProps: { method: 'GET' },
-            },
-            {
-              type: 'link',
-              label: 'ICT Audience Subtypes and Extensions',
-              href: '/healthcare-vertical/audience-healthcare#ict-audience-subtypes-and-extensions',
-              customProps: { method: 'GET' },
-            },
-            {
-              type: 'link',
-              label: 'Create ICT Audience',
-              href: '/healthcare-vertical/audience-healthcare#create-ict-audience',
-              customProps: { method: 'POST' },
-            }
-          ]
-        },
-        {
-          type: `category`,
-          label: `Geofarmed Audiences`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Geofarmed Audience Details',
-              href: '/healthcare-vertical/audience-healthcare#geofarmed-audience-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Create Geofarmed Audience',
-              href: '/healthcare-vertical/audience-healthcare#create-geofarmed-audience',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            }
-          ]
-        },
-        {
-          type: `category`,
-          label: `Contextual Audiences`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Contextual Audience Details',
-              href: '/healthcare-vertical/audience-healthcare#contextual-audience-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Create Contextual Audience',
-              href: '/healthcare-vertical/audience-healthcare#create-contextual-audience',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            }
-          ]
-        },
-        {
-          type: `category`,
-          label: `Campaign Audiences`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Campaign Audience Details',
-              href: '/healthcare-vertical/audience-healthcare#campaign-audience-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Create Campaign Audience',
-              href: '/healthcare-vertical/audience-healthcare#create-campaign-audience',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Get Campaign Audience History',
-              href: '/healthcare-vertical/audience-healthcare#get-campaign-audience-history',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            }
-          ]
-        },
-      ]
-    },
-    {
-      type: 'category',
-      label: 'Finance API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'healthcare-vertical/finance'
-      },
-      items: [
-            {
-              type: 'link',
-              label: 'Customer Insights Fees Details',
-              href: '/healthcare-vertical/finance/#get-customer-insights-fees-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Update Customer Insights Fees Details',
-              href: '/healthcare-vertical/finance/#update-customer-insights-fees-details',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem'
-            }
-          ]
-    },
-    {
-      type: 'category',
-      label: 'Insights API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'healthcare-vertical/insights-pld'
-      },
-      items: [
-        {
-          type: `category`,
-          label: `Insights Details`,
-          className: 'sidebarItem',
-          items: [
-              {
-              type: 'link',
-              label: 'Get Eligible Campaigns',
-              href: '/healthcare-vertical/insights-pld#get-eligible-campaigns',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Calculate Insights Computation',
-              href: '/healthcare-vertical/insights-pld#calculate-insights-computation',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem'
-            }
-          ]
-        },
-        {  
-          type: 'category',
-          label: 'Audience Quality Score Reports',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'AQS Eligibility Requirements',
-              href: '/healthcare-vertical/insights-pld#aqs-eligibility-requirements',
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'AQS Resource Properties',
-              href: '/healthcare-vertical/insights-pld#aqs-resource-properties',
-            },
-            {
-              type: 'link',
-              label: 'List of AQS Reports',
-              href: '/healthcare-vertical/insights-pld#get-list-of-aqs-reports',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Campaigns Eligible for AQS Reports',
-              href: '/healthcare-vertical/insights-pld#get-list-of-campaigns-eligible-for-aqs-reports',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Validate AQS Report Name',
-              href: '/healthcare-vertical/insights-pld#validate-aqs-report-name',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Compute AQS Report Cost',
-              href: '/healthcare-vertical/insights-pld#compute-aqs-report-cost',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Generate AQS Report',
-              href: '/healthcare-vertical/insights-pld#generate-aqs-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'AQS Report Types',
-              href: '/healthcare-vertical/insights-pld#get-aqs-report-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Download AQS Report',
-              href: '/healthcare-vertical/insights-pld#download-aqs-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Delete AQS Report',
-              href: '/healthcare-vertical/insights-pld#delete-aqs-report',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem',
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'ScriptLift Studies Reports',
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'SLS Eligibility Requirements',
-              href: '/healthcare-vertical/insights-pld#sls-eligiblity-requirements',
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'SLS Resource Properties',
-              href: '/healthcare-vertical/insights-pld#sls-resource-properties',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'List of SLS Reports',
-              href: '/healthcare-vertical/insights-pld#get-list-of-sls-reports',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Generate SLS Report',
-              href: '/healthcare-vertical/insights-pld#generate-sls-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'SLS Reports Computation',
-              href: '/healthcare-vertical/insights-pld#sls-reports-computation',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Validate SLS Report Name',
-              href: '/healthcare-vertical/insights-pld#validate-sls-report-name',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Campaigns Eligible for SLS Reports',
-              href: '/healthcare-vertical/insights-pld#get-list-of-campaigns-eligible-for-sls-reports',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Download SLS Insight Report',
-              href: '/healthcare-vertical/insights-pld#download-sls-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Delete SLS Report',
-              href: '/healthcare-vertical/insights-pld#delete-sls-report',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem',
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Report Templates`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'PLD Eligibility Requirements',
-              href: '/healthcare-vertical/insights-pld#pld-eligibility-requirements',
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'NLD Eligibility Requirements',
-              href: '/healthcare-vertical/insights-pld#nld-eligibility-requirements',
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'ICT Eligibility Requirements',
-              href: '/healthcare-vertical/insights-pld#ict-eligibility-requirements',
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'List of Templates',
-              href: '/healthcare-vertical/insights-pld#get-list-of-templates',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Template Details',
-              href: '/healthcare-vertical/insights-pld#get-template-details',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Template Reports',
-              href: '/healthcare-vertical/insights-pld#get-template-reports',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Validate Template Name',
-              href: '/healthcare-vertical/insights-pld#validate-template-name',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Create Report Template',
-              href: '/healthcare-vertical/insights-pld#create-report-template',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Update Report Template',
-              href: '/healthcare-vertical/insights-pld#update-report-template',
-              customProps: { method: 'PATCH' },
-              className: 'sidebarItem',
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `Report Management`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'Download Report',
-              href: '/healthcare-vertical/insights-pld#download-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Delete Report',
-              href: '/healthcare-vertical/insights-pld#delete-report',
-              customProps: { method: 'DEL' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Email Report',
-              href: '/healthcare-vertical/insights-pld#email-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Regenerate Report',
-              href: '/healthcare-vertical/insights-pld#regenerate-report',
-              customProps: { method: 'POST' },
-              className: 'sidebarItem',
-            },
-          ]
-        },
-        {
-          type: `category`,
-          label: `More Insights Details`,
-          className: 'sidebarItem',
-          items: [
-            {
-              type: 'link',
-              label: 'List of Insights Types',
-              href: '/healthcare-vertical/insights-pld#get-list-of-insights-types',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'List of Insights Status',
-              href: '/healthcare-vertical/insights-pld#get-list-of-insights-status',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Template Statuses',
-              href: '/healthcare-vertical/insights-pld#get-list-of-template-statuses',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-            {
-              type: 'link',
-              label: 'Scheduling Frequencies',
-              href: '/healthcare-vertical/insights-pld#get-scheduling-frequencies',
-              customProps: { method: 'GET' },
-              className: 'sidebarItem'
-            },
-          ]
-        },
-      ]
-    },
-    {
-      type: 'category',
-      label: 'Planner API',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'healthcare-vertical/planner'
-      },
-      items: [
-            {
-              type: 'category',
-              label: 'HCP Planner Details',
-              className: 'sidebarItem',
-              items: [
-                  {
-                    type: 'link',
-                    label: 'HCP Planner Resource Properties',
-                    href: '/healthcare-vertical/planner/#hcp-planner-resource-properties',
-                    className: 'sidebarItem',
-                  },
-                  {
-                    type: 'link',
-                    label: 'HCP Planner Details by ID',
-                    href: '/healthcare-vertical/planner/#hcp-planner-details-by-id',
-                    customProps: { method: 'GET' },
-                    className: 'sidebarItem',
-                  },    
-                  {
-                    type: 'link',
-                    label: 'List of HCP Planners',
-                    href: '/healthcare-vertical/planner/#get-list-of-hcp-planners',
-                    customProps: { method: 'GET' },
-                    className: 'sidebarItem',
-                  },
-                  {
-                    type: 'link',
-                    label: 'List of Accounts',
-                    href: '/healthcare-vertical/planner/#get-list-of-accounts',
-                    customProps: { method: 'GET' },
-                    className: 'sidebarItem',
-                  },
-                  {
-                    type: 'link',
-                    label: 'Download HCP Planner',
-                    href: '/healthcare-vertical/planner/#download-hcp-planner',
-                    customProps: { method: 'POST' },
-                    className: 'sidebarItem',
-                  }
-               ]
-            },
-            {
-              type: 'category',
-              label: 'HCP Planner Management',
-              className: 'sidebarItem',
-              items: [
-                  {
-                    type: 'link',
-                    label: 'Create HCP Planner',
-                    href: '/healthcare-vertical/planner/#create-hcp-planner',
-                    customProps: { method: 'POST' },
-                    className: 'sidebarItem',
-                  },    
-                  {
-                    type: 'link',
-                    label: 'Update HCP Planner',
-                    href: '/healthcare-vertical/planner/#update-hcp-planner',
-                    customProps: { method: 'PUT' },
-                    className: 'sidebarItem',
-                  },
-                  {
-                    type: 'link',
-                    label: 'Delete HCP Planner',
-                    href: '/healthcare-vertical/planner/#delete-hcp-planner',
-                    customProps: { method: 'DEL' },
-                    className: 'sidebarItem',
-                  },
-                  {
-                    type: 'link',
-                    label: 'Validate Planner Name',
-                    href: '/healthcare-vertical/planner/#validate-planner-name',
-                    customProps: { method: 'POST' },
-                    className: 'sidebarItem',
-                  },
-                  {
-                    type: 'link',
-                    label: 'Get Targeting Graphs',
-                    href: '/healthcare-vertical/planner/#get-targeting-graphs',
-                    customProps: { method: 'POST' },
-                    className: 'sidebarItem',
-                  },
-                  {
-                    type: 'link',
-                    label: 'Get Audience Graph',
-                    href: '/healthcare-vertical/planner/#get-audience-graph',
-                    customProps: { method: 'POST' },
-                    className: 'sidebarItem',
-                  },
-                  {
-                    type: 'link',
-                    label: 'Get Audience Summary',
-                    href: '/healthcare-vertical/planner/#get-audience-summary',
-                    customProps: { method: 'POST' },
-                    className: 'sidebarItem',
-                  },
-                  {
-                    type: 'link',
-                    label: 'Generate Campaigns Plan',
-                    href: '/healthcare-vertical/planner/#generate-campaigns-plan',
-                    customProps: { method: 'POST' },
-                    className: 'sidebarItem',
-                  },
-                  {
-                    type: 'link',
-                    label: 'Publish Campaigns Plan',
-                    href: '/healthcare-vertical/planner/#publish-campaigns-plan',
-                    customProps: { method: 'POST' },
-                    className: 'sidebarItem',
-                  }
-               ]
-            },
-            {
-              type: 'category',
-              label: 'More HCP Details',
-              className: 'sidebarItem',
-              items: [
-                  {
-                    type: 'link',
-                    label: 'Split Strategy List',
-                    href: '/healthcare-vertical/planner/#get-split-strategy-list',
-                    customProps: { method: 'GET' },
-                    className: 'sidebarItem',
-                  },
-                  {
-                    type: 'link',
-                    label: 'NPI Type List',
-                    href: '/healthcare-vertical/planner/#npi-type-list',
-                    customProps: { method: 'GET' },
-                    className: 'sidebarItem',
-                  },
-                  {
-                    type: 'link',
-                    label: 'Get Geography Segments',
-                    href: '/healthcare-vertical/planner/#get-geography-segments',
-                    customProps: { method: 'GET' },
-                    className: 'sidebarItem',
-                  },
-                  {
-                    type: 'link',
-                    label: 'Get Data Partners List',
-                    href: '/healthcare-vertical/planner/#get-data-partners-list',
-                    customProps: { method: 'GET' },
-                    className: 'sidebarItem',
-                  },
-                  {
-                    type: 'link',
-                    label: 'Get Audience Selection Methods List',
-                    href: '/healthcare-vertical/planner/#get-audience-selection-methods-list',
-                    customProps: { method: 'GET' },
-                    className: 'sidebarItem',
-                  },
-                  {
-                    type: 'link',
-                    label: 'Get Specialties List',
-                    href: '/healthcare-vertical/planner/#get-specialties-list',
-                    customProps: { method: 'GET' },
-                    className: 'sidebarItem',
-                  },
-                  {
-                    type: 'link',
-                    label: 'Get Account Types',
-                    href: '/healthcare-vertical/planner/#get-account-types',
-                    customProps: { method: 'GET' },
-                    className: 'sidebarItem',
-                  }
-              ]
-            }          
-          ]
-    }
+    doc('healthcare-vertical/index', 'Healthcare'),
+    category('Audience API', 'healthcare-vertical/audience-healthcare', [
+      category('Audience Details', null, endpoints('/healthcare-vertical/audience-healthcare', 'audience-details')),
+      category('Healthcare Data Details', null, endpoints('/healthcare-vertical/audience-healthcare', 'healthcare-data-details')),
+      category('Matched Audiences', null, endpoints('/healthcare-vertical/audience-healthcare', 'matched-audiences')),
+      category('ABM Audiences', null, endpoints('/healthcare-vertical/audience-healthcare', 'abm-audiences')),
+      category('ICT Audiences', null, endpoints('/healthcare-vertical/audience-healthcare', 'ict-audiences')),
+      category('Geofarmed Audiences', null, endpoints('/healthcare-vertical/audience-healthcare', 'geofarmed-audiences')),
+      category('Contextual Audiences', null, endpoints('/healthcare-vertical/audience-healthcare', 'contextual-audience')),
+      category('Campaign Audiences', null, endpoints('/healthcare-vertical/audience-healthcare', 'campaign-audiences')),
+    ]),
+    category('Finance API', 'healthcare-vertical/finance', endpoints('/healthcare-vertical/finance/', 'finance-details')),
+    category('Insights API', 'healthcare-vertical/insights-pld', [
+      category('Insights Details', null, endpoints('/healthcare-vertical/insights-pld', 'insights-details')),
+      category('Audience Quality Score Reports', null, endpoints('/healthcare-vertical/insights-pld', 'audience-quality-score-reports')),
+      category('ScriptLift Studies Reports', null, [
+        link('/healthcare-vertical/insights-pld#sls-eligiblity-requirements', 'SLS Eligibility Requirements'),
+        endpoint('/healthcare-vertical/insights-pld#sls-resource-properties', 'SLS Resource Properties', 'GET'),
+        endpoint('/healthcare-vertical/insights-pld#get-list-of-sls-reports'),
+        endpoint('/healthcare-vertical/insights-pld#generate-sls-report'),
+        endpoint('/healthcare-vertical/insights-pld#sls-reports-computation'),
+        endpoint('/healthcare-vertical/insights-pld#validate-sls-report-name'),
+        endpoint('/healthcare-vertical/insights-pld#get-list-of-campaigns-eligible-for-sls-reports'),
+        endpoint('/healthcare-vertical/insights-pld#download-sls-report'),
+        endpoint('/healthcare-vertical/insights-pld#delete-sls-report'),
+      ]),
+      category('Report Templates', null, endpoints('/healthcare-vertical/insights-pld', 'report-templates')),
+      category('Report Management', null, endpoints('/healthcare-vertical/insights-pld', 'report-management')),
+      category('More Insights Details', null, endpoints('/healthcare-vertical/insights-pld', 'get-more-insights-details')),
+    ]),
+    category('Planner API', 'healthcare-vertical/planner', [
+      category('HCP Planner Details', null, endpoints('/healthcare-vertical/planner/', 'healthcare-proposal-planner-details')),
+      category('HCP Planner Management', null, endpoints('/healthcare-vertical/planner/', 'healthcare-proposal-planner-management')),
+      category('More HCP Details', null, endpoints('/healthcare-vertical/planner/', 'more-hcp-details')),
+    ]),
   ],
   partnershipsSidebar: [
-    {
-      type: 'category',
-      label: 'Partnerships & Integrations',
-      className: 'sidebarCategory',
-      link: {
-        type: 'doc',
-        id: 'partnerships/index'
-      },
-      items: [
-        {
-          type: 'category',
-          label: 'Reporting Integrations',
-          className: 'sidebarItem',
-          collapsible: true,
-          collapsed: false,
-          items: [
-            {
-              type: 'doc',
-              id: 'partnerships/google-looker-studio',
-              label: 'Google Looker Studio',
-              className: 'sidebarItem',
-            },
-            {
-              type: 'doc',
-              id: 'partnerships/google-sheets',
-              label: 'Google Sheets',
-              className: 'sidebarItem',
-            },
-            {
-              type: 'doc',
-              id: 'partnerships/microsoft-power-bi',
-              label: 'Microsoft Power BI',
-              className: 'sidebarItem',
-            },
-            {
-              type: 'doc',
-              id: 'partnerships/tableau',
-              label: 'Tableau',
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Supermetrics',
-              href: 'https://docs.supermetrics.com/docs/iqm',
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'TapClicks',
-              href: 'https://www.tapclicks.com/resources/connectors/iqm-reports/',
-              className: 'sidebarItem',
-            },
-            {
-              type: 'doc',
-              id: 'partnerships/improvado',
-              label: 'Improvado',
-              className: 'sidebarItem',
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'CRM Integrations',
-          className: 'sidebarItem',
-          collapsible: true,
-          collapsed: false,
-          items: [
-            {
-              type: 'doc',
-              id: 'partnerships/hubspot',
-              label: 'HubSpot',
-              className: 'sidebarItem',
-            },
-          ]
-        },
-        {
-          type: 'category',
-          label: 'Automation Integrations',
-          className: 'sidebarItem',
-          collapsible: true,
-          collapsed: false,
-          items: [
-            {
-              type: 'doc',
-              id: 'partnerships/zapier',
-              label: 'Zapier',
-              className: 'sidebarItem',
-            },
-            {
-              type: 'link',
-              label: 'Make',
-              href: 'https://www.make.com/en/integrations/iqmreports',
-              className: 'sidebarItem',
-            },
-          ]
-        },
-      ]
-    }
-  ]
-}
+    category('Partnerships & Integrations', 'partnerships/index', [
+      category('Reporting Integrations', null, [
+        doc('partnerships/google-looker-studio', 'Google Looker Studio'),
+        doc('partnerships/google-sheets', 'Google Sheets'),
+        doc('partnerships/microsoft-power-bi', 'Microsoft Power BI'),
+        doc('partnerships/tableau', 'Tableau'),
+        link('https://docs.supermetrics.com/docs/iqm', 'Supermetrics'),
+        link('https://www.tapclicks.com/resources/connectors/iqm-reports/', 'TapClicks'),
+        doc('partnerships/improvado', 'Improvado'),
+      ], {collapsible: true, collapsed: false}),
+      category('CRM Integrations', null, [
+        doc('partnerships/hubspot', 'HubSpot'),
+      ], {collapsible: true, collapsed: false}),
+      category('Automation Integrations', null, [
+        doc('partnerships/zapier', 'Zapier'),
+        link('https://www.make.com/en/integrations/iqmreports', 'Make'),
+      ], {collapsible: true, collapsed: false}),
+    ]),
+  ],
+};
 
 export default sidebars;
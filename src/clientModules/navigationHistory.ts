@@ -0,0 +1,17 @@
+/**
+ * Records which route readers open from which (see
+ * src/utils/navigationHistory), for src/components/RoutePrefetcher.
+ */
+
+import type {ClientModule} from '@docusaurus/types';
+import {recordNavigation} from '@site/src/utils/navigationHistory';
+
+const clientModule: ClientModule = {
+  onRouteDidUpdate({location, previousLocation}) {
+    if (previousLocation && location.pathname !== previousLocation.pathname) {
+      recordNavigation(previousLocation.pathname, location.pathname);
+    }
+  },
+};
+
+export default clientModule;
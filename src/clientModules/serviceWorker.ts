@@ -0,0 +1,20 @@
+/**
+ * Keeps the offline service worker (plugins/offline) registered for readers
+ * who opted in, so each visit picks up the worker of the latest deploy.
+ */
+
+import ExecutionEnvironment from '@docusaurus/ExecutionEnvironment';
+import siteConfig from '@generated/docusaurus.config';
+import {enableOffline, isOfflineEnabled, isOfflineSupported} from '@site/src/utils/offline';
+
+// sw.js is only written by production builds
+if (
+  ExecutionEnvironment.canUseDOM &&
+  process.env.NODE_ENV === 'production' &&
+  isOfflineSupported() &&
+  isOfflineEnabled()
+) {
+  window.addEventListener('load', () => {
+    enableOffline(`${siteConfig.baseUrl}sw.js`).catch(() => undefined);
+  });
+}
@@ -0,0 +1,192 @@
+/**
+ * Reports Web Vitals of real visits to GA4 through the gtag plugin, as one
+ * `web_vitals` event per route visited:
+ *
+ * - `lcp`, `ttfb` and `hydration` (ms) for the page the visit landed on
+ * - `cls` and `inp` (worst interaction, ms) for every route, including
+ *   client-side navigations
+ * - `doc_section`: guidelines, quickstart-guides, tutorials, verticals or
+ *   other
+ *
+ * Only a sample of sessions is measured; the others don't even register the
+ * performance observers. Events are queued and sent together with the
+ * beacon transport when the page is hidden, or once a few routes queued up.
+ *
+ * Hiding the page (switching tabs) doesn't end the route: what was measured
+ * so far is sent, and the route is sent again if it changed by the time it
+ * is left. Both events have the same `route_id`; keep the last one of each.
+ */
+
+import ExecutionEnvironment from '@docusaurus/ExecutionEnvironment';
+import type {ClientModule} from '@docusaurus/types';
+import {sendGAEvent} from '@site/src/utils/analytics';
+
+const SAMPLE_RATE = 0.1;
+const SAMPLE_KEY = 'iqm-web-vitals-sampled';
+const BATCH_SIZE = 5;
+// Minimum duration of the interactions observed for INP (the spec's minimum is 16ms)
+const EVENT_DURATION_THRESHOLD = 40;
+
+const SECTIONS: Record<string, string> = {
+  guidelines: 'guidelines',
+  'quickstart-guides': 'quickstart-guides',
+  tutorials: 'tutorials',
+  'healthcare-vertical': 'verticals',
+  'political-vertical': 'verticals',
+};
+
+interface RouteVitals {
+  id: string;
+  path: string;
+  cls: number;
+  inp: number;
+  lcp?: number;
+  ttfb?: number;
+  hydration?: number;
+  // Values of the last event sent for the route
+  sent?: string;
+}
+
+const moduleStart = ExecutionEnvironment.canUseDOM ? performance.now() : 0;
+const queue: RouteVitals[] = [];
+let current: RouteVitals | null = null;
+let landing: RouteVitals | null = null;
+// Current CLS session window
+let sessionValue = 0;
+let sessionStart = 0;
+let sessionEnd = 0;
+
+function isSampled(): boolean {
+  try {
+    let sampled = sessionStorage.getItem(SAMPLE_KEY);
+    if (sampled === null) {
+      sampled = Math.random() < SAMPLE_RATE ? '1' : '0';
+      sessionStorage.setItem(SAMPLE_KEY, sampled);
+    }
+    return sampled === '1';
+  } catch {
+    return false;
+  }
+}
+
+const sectionOf = (path: string) => SECTIONS[path.split('/')[1]] ?? 'other';
+
+const newRoute = (path: string): RouteVitals => ({
+  id: `${Date.now().toString(36)}-${Math.random().toString(36).slice(2, 8)}`,
+  path,
+  cls: 0,
+  inp: 0,
+});
+
+function flush() {
+  for (const vitals of queue.splice(0)) {
+    sendGAEvent('web_vitals', {
+      route_id: vitals.id,
+      page_path: vitals.path,
+      doc_section: sectionOf(vitals.path),
+      cls: Math.round(vitals.cls * 1000) / 1000,
+      inp: Math.round(vitals.inp),
+      ...(vitals.lcp !== undefined && {lcp: Math.round(vitals.lcp)}),
+      ...(vitals.ttfb !== undefined && {ttfb: Math.round(vitals.ttfb)}),
+      ...(vitals.hydration !== undefined && {hydration: Math.round(vitals.hydration)}),
+      non_interaction: true,
+      transport_type: 'beacon',
+    });
+  }
+}
+
+/** Queues what was measured on the current route, unless it was already sent */
+function snapshot() {
+  if (!current) return;
+  const {sent, ...vitals} = current;
+  const values = JSON.stringify(vitals);
+  if (values === sent) return;
+  current.sent = values;
+  queue.push(vitals);
+}
+
+function finishRoute() {
+  snapshot();
+  current = null;
+  if (queue.length >= BATCH_SIZE) flush();
+}
+
+function observe(type: string, callback: (entries: PerformanceEntry[]) => void, options: object = {}) {
+  try {
+    new PerformanceObserver((list) => callback(list.getEntries())).observe({type, buffered: true, ...options});
+  } catch {
+    // Entry type not supported by this browser
+  }
+}
+
+function start() {
+  const [navigation] = performance.getEntriesByType('navigation') as PerformanceNavigationTiming[];
+  current = newRoute(window.location.pathname);
+  landing = current;
+  if (navigation) {
+    const activationStart = (navigation as any).activationStart ?? 0;
+    current.ttfb = Math.max(navigation.responseStart - activationStart, 0);
+  }
+
+  observe('largest-contentful-paint', (entries) => {
+    // The browser stops reporting LCP candidates after the first input
+    if (landing) landing.lcp = entries[entries.length - 1].startTime;
+  });
+
+  observe('layout-shift', (entries) => {
+    for (const entry of entries as (PerformanceEntry & {value: number; hadRecentInput: boolean})[]) {
+      if (entry.hadRecentInput || !current) continue;
+      if (sessionValue && entry.startTime - sessionEnd < 1000 && entry.startTime - sessionStart < 5000) {
+        sessionValue += entry.value;
+      } else {
+        sessionValue = entry.value;
+        sessionStart = entry.startTime;
+      }
+      sessionEnd = entry.startTime;
+      current.cls = Math.max(current.cls, sessionValue);
+    }
+  });
+
+  observe(
+    'event',
+    (entries) => {
+      for (const entry of entries as (PerformanceEntry & {interactionId?: number})[]) {
+        if (entry.interactionId && current) current.inp = Math.max(current.inp, entry.duration);
+      }
+    },
+    {durationThreshold: EVENT_DURATION_THRESHOLD},
+  );
+
+  // The route goes on after the tab is shown again: later shifts and
+  // interactions still count towards it
+  addEventListener('visibilitychange', () => {
+    if (document.visibilityState === 'hidden') {
+      snapshot();
+      flush();
+    }
+  });
+  addEventListener('pagehide', () => {
+    snapshot();
+    flush();
+  });
+}
+
+const enabled = ExecutionEnvironment.canUseDOM && typeof PerformanceObserver !== 'undefined' && isSampled();
+if (enabled) start();
+
+const clientModule: ClientModule = {
+  onRouteDidUpdate({location, previousLocation}) {
+    if (!enabled) return;
+    if (!previousLocation) {
+      // Fires once the first render has hydrated
+      if (landing) landing.hydration = performance.now() - moduleStart;
+      return;
+    }
+    if (location.pathname === previousLocation.pathname) return;
+    finishRoute();
+    current = newRoute(location.pathname);
+    sessionValue = 0;
+  },
+};
+
+export default clientModule;
@@ -1,4 +1,5 @@
 import React, {useId, useMemo, useState} from 'react';
+import { LazyMount } from '@site/src/components/LazyMount';
 
 export type CodeOptionProps = {
   /** Visible label in the select menu */
@@ -116,11 +117,12 @@ export const CodeDropdown: React.FC<CodeDropdownProps> = ({
       )}
 
       <div style={{ padding: 0, ...(variant === 'minimal' ? { paddingTop: 'var(--ifm-heading-margin-bottom)' } : {}) }}>
+        {/* Unselected options keep their server HTML but hydrate on first selection */}
         {items.map(o => (
           <div key={o.value} style={{ display: o.value === selected ? 'block' : 'none',
             backgroundColor: 'transparent',
            }}>
-            {o.node}
+            <LazyMount active={o.value === selected}>{o.node}</LazyMount>
           </div>
         ))}
       </div>
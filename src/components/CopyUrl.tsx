@@ -1,4 +1,5 @@
 import React from "react";
+import type RequestRunnerType from "./RequestRunner";
 
 type Method = "GET" | "POST" | "PUT" | "PATCH" | "DELETE";
 
@@ -42,14 +43,21 @@ function splitUrlForDisplay(full: string): {
   }
 }
 
+// The runner is only downloaded once a reader opens it
+const loadRunner = () => import("./RequestRunner").then((mod) => mod.default);
+
 export default function CopyUrl({
   method = "GET",
   url,
+  paging,
 }: {
   method?: string;
   url: string;
+  /** Pagination parameters of a list endpoint, set by plugins/openapi/remark-endpoint */
+  paging?: string;
 }) {
   const [copied, setCopied] = React.useState(false);
+  const [Runner, setRunner] = React.useState<typeof RequestRunnerType | null>(null);
   const m = (method || "GET").trim().toUpperCase() as Method;
   const badgeClass = BADGE_BY_METHOD[m] ?? BADGE_BY_METHOD.GET;
 
@@ -63,6 +71,11 @@ const { origin, restDisplay } = splitUrlForDisplay(url);
     } catch {}
   }
 
+  async function onTry() {
+    const component = await loadRunner();
+    setRunner(() => component);
+  }
+
 return (
   <span className="copy-url">
     <span className={`badge ${badgeClass}`}>{m}</span>
@@ -77,6 +90,17 @@ return (
       {origin && <span className="path-text__origin">{origin}</span>}
       <span className="path-text__rest">{restDisplay}</span>
     </button>
+    <button
+      type="button"
+      className="copy-url__try"
+      onClick={onTry}
+      onPointerEnter={loadRunner}
+      aria-label={`Try ${m} ${url}`}
+      aria-haspopup="dialog"
+    >
+      Try it
+    </button>
+    {Runner && <Runner method={m} url={url} paging={paging} onClose={() => setRunner(null)} />}
     </span>
   );
 }
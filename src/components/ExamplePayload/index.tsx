@@ -0,0 +1,317 @@
+import React, {useCallback, useMemo, useRef, useState} from 'react';
+import clsx from 'clsx';
+import styles from './styles.module.css';
+
+interface ExamplePayloadProps {
+  /** From the fence's `title="..."` */
+  title?: string;
+  /** URL of the JSON asset, emitted by plugins/example-payloads/remark */
+  src: string;
+  /** Size of the payload, shown while collapsed */
+  bytes: number;
+  /** Top-level keys or items */
+  entries: number;
+  /** JSON pointers of the members marked with `// highlight-next-line` */
+  highlight?: string[];
+}
+
+type Json = null | boolean | number | string | Json[] | {[key: string]: Json};
+
+interface Row {
+  pointer: string;
+  depth: number;
+  key?: string | number;
+  value: Json;
+  /** Closing `}` / `]` of an expanded container */
+  closing?: boolean;
+  last: boolean;
+}
+
+const ROW_HEIGHT = 20;
+const MAX_HEIGHT = 480;
+const OVERSCAN = 10;
+// Containers opened on first render
+const INITIAL_DEPTH = 2;
+
+const payloads = new Map<string, Promise<string>>();
+
+function fetchPayload(src: string): Promise<string> {
+  if (!payloads.has(src)) {
+    const request = fetch(src).then((response) => {
+      if (!response.ok) throw new Error(`HTTP ${response.status}`);
+      return response.text();
+    });
+    // A failed request can be retried
+    request.catch(() => payloads.delete(src));
+    payloads.set(src, request);
+  }
+  return payloads.get(src)!;
+}
+
+const isContainer = (value: Json): value is Json[] | {[key: string]: Json} =>
+  value !== null && typeof value === 'object';
+
+const childrenOf = (value: Json[] | {[key: string]: Json}): [string | number, Json][] =>
+  Array.isArray(value) ? value.map((item, index) => [index, item]) : Object.entries(value);
+
+const pointerSegment = (key: string | number) => String(key).replace(/~/g, '~0').replace(/\//g, '~1');
+
+/** Pointers of the containers open initially: the first levels and the path to each highlight */
+function initialExpanded(root: Json, highlight: string[]): Set<string> {
+  const expanded = new Set<string>();
+  const walk = (value: Json, pointer: string, depth: number) => {
+    if (!isContainer(value) || depth >= INITIAL_DEPTH) return;
+    expanded.add(pointer);
+    for (const [key, child] of childrenOf(value)) walk(child, `${pointer}/${pointerSegment(key)}`, depth + 1);
+  };
+  walk(root, '', 0);
+  for (const pointer of highlight) {
+    const segments = pointer.split('/');
+    for (let end = 1; end < segments.length; end++) expanded.add(segments.slice(0, end).join('/'));
+  }
+  return expanded;
+}
+
+function allContainers(root: Json): Set<string> {
+  const pointers = new Set<string>();
+  const walk = (value: Json, pointer: string) => {
+    if (!isContainer(value)) return;
+    pointers.add(pointer);
+    for (const [key, child] of childrenOf(value)) walk(child, `${pointer}/${pointerSegment(key)}`);
+  };
+  walk(root, '');
+  return pointers;
+}
+
+/** Rows of the expanded part of the tree, in display order */
+function visibleRows(root: Json, expanded: Set<string>): Row[] {
+  const rows: Row[] = [];
+  const walk = (value: Json, pointer: string, depth: number, key: string | number | undefined, last: boolean) => {
+    rows.push({pointer, depth, key, value, last});
+    if (!isContainer(value) || !expanded.has(pointer)) return;
+    const children = childrenOf(value);
+    children.forEach(([childKey, child], index) =>
+      walk(child, `${pointer}/${pointerSegment(childKey)}`, depth + 1, childKey, index === children.length - 1),
+    );
+    rows.push({pointer, depth, value, closing: true, last});
+  };
+  walk(root, '', 0, undefined, true);
+  return rows;
+}
+
+function formatBytes(bytes: number): string {
+  return bytes < 1024 ? `${bytes} B` : `${(bytes / 1024).toFixed(1)} KB`;
+}
+
+function Scalar({value}: {value: Json}) {
+  if (typeof value === 'string') return <span className="token string">{JSON.stringify(value)}</span>;
+  if (typeof value === 'number') return <span className="token number">{value}</span>;
+  if (typeof value === 'boolean') return <span className="token boolean">{String(value)}</span>;
+  return <span className="token null keyword">null</span>;
+}
+
+function TreeRow({row, expanded, highlighted, onToggle}: {
+  row: Row;
+  expanded: boolean;
+  highlighted: boolean;
+  onToggle: (pointer: string) => void;
+}) {
+  const {value, key, depth, closing, last} = row;
+  const comma = last ? null : <span className="token punctuation">,</span>;
+  const indent = {paddingLeft: `${depth * 1.25 + 1.25}rem`};
+
+  if (closing) {
+    return (
+      <div className={styles.row} style={indent}>
+        <span className="token punctuation">{Array.isArray(value) ? ']' : '}'}</span>
+        {comma}
+      </div>
+    );
+  }
+
+  const label =
+    key === undefined ? null : typeof key === 'number' ? (
+      <span className={styles.index}>{key}: </span>
+    ) : (
+      <>
+        <span className="token property">{JSON.stringify(key)}</span>
+        <span className="token operator">: </span>
+      </>
+    );
+
+  if (!isContainer(value)) {
+    return (
+      <div className={clsx(styles.row, highlighted && styles.highlighted)} style={indent}>
+        {label}
+        <Scalar value={value} />
+        {comma}
+      </div>
+    );
+  }
+
+  const [open, close] = Array.isArray(value) ? ['[', ']'] : ['{', '}'];
+  const size = Array.isArray(value) ? value.length : Object.keys(value).length;
+  const noun = Array.isArray(value) ? (size === 1 ? 'item' : 'items') : size === 1 ? 'key' : 'keys';
+  return (
+    <div className={clsx(styles.row, highlighted && styles.highlighted)} style={indent}>
+      <button
+        type="button"
+        className={clsx('clean-btn', styles.toggle)}
+        aria-expanded={expanded}
+        aria-label={`${expanded ? 'Collapse' : 'Expand'} ${key ?? 'root'}`}
+        onClick={() => onToggle(row.pointer)}
+        disabled={size === 0}
+      >
+        {expanded ? '▾' : '▸'}
+      </button>
+      {label}
+      <span className="token punctuation">{open}</span>
+      {!expanded && (
+        <>
+          {size > 0 && (
+            <button type="button" className={clsx('clean-btn', styles.summary)} onClick={() => onToggle(row.pointer)}>
+              {size} {noun}
+            </button>
+          )}
+          <span className="token punctuation">{close}</span>
+          {comma}
+        </>
+      )}
+    </div>
+  );
+}
+
+/** Collapsible tree of `root`, rendering only the rows scrolled into view */
+function JsonTree({root, highlight}: {root: Json; highlight: string[]}) {
+  const [expanded, setExpanded] = useState(() => initialExpanded(root, highlight));
+  const [scrollTop, setScrollTop] = useState(0);
+  const rows = useMemo(() => visibleRows(root, expanded), [root, expanded]);
+  const highlighted = useMemo(() => new Set(highlight), [highlight]);
+
+  const onToggle = useCallback((pointer: string) => {
+    setExpanded((current) => {
+      const next = new Set(current);
+      if (!next.delete(pointer)) next.add(pointer);
+      return next;
+    });
+  }, []);
+
+  const height = Math.min(rows.length * ROW_HEIGHT, MAX_HEIGHT);
+  const first = Math.max(0, Math.floor(scrollTop / ROW_HEIGHT) - OVERSCAN);
+  const last = Math.min(rows.length, Math.ceil((scrollTop + height) / ROW_HEIGHT) + OVERSCAN);
+
+  return (
+    <>
+      <div className={styles.treeActions}>
+        <button type="button" className={clsx('clean-btn', styles.action)} onClick={() => setExpanded(allContainers(root))}>
+          Expand all
+        </button>
+        <button type="button" className={clsx('clean-btn', styles.action)} onClick={() => setExpanded(new Set())}>
+          Collapse all
+        </button>
+      </div>
+      <div
+        className={clsx('thin-scrollbar', styles.viewport)}
+        style={{height}}
+        onScroll={(event) => setScrollTop(event.currentTarget.scrollTop)}
+        tabIndex={0}
+      >
+        <div style={{height: rows.length * ROW_HEIGHT, position: 'relative'}}>
+          <div style={{transform: `translateY(${first * ROW_HEIGHT}px)`}}>
+            {rows.slice(first, last).map((row) => (
+              <TreeRow
+                key={`${row.pointer}${row.closing ? '#end' : ''}`}
+                row={row}
+                expanded={expanded.has(row.pointer)}
+                highlighted={highlighted.has(row.pointer)}
+                onToggle={onToggle}
+              />
+            ))}
+          </div>
+        </div>
+      </div>
+    </>
+  );
+}
+
+/**
+ * Example response moved out of the page by plugins/example-payloads/remark:
+ * the JSON is fetched when the reader opens it and shown as a collapsible
+ * tree.
+ */
+export default function ExamplePayload({title, src, bytes, entries, highlight = []}: ExamplePayloadProps) {
+  const [open, setOpen] = useState(false);
+  const [payload, setPayload] = useState<{text: string; root: Json} | null>(null);
+  const [error, setError] = useState(false);
+  const [copied, setCopied] = useState(false);
+  const requested = useRef(false);
+
+  function load() {
+    if (requested.current) return;
+    requested.current = true;
+    setError(false);
+    fetchPayload(src)
+      .then((text) => setPayload({text, root: JSON.parse(text)}))
+      .catch(() => {
+        requested.current = false;
+        setError(true);
+      });
+  }
+
+  function onToggle() {
+    setOpen((current) => !current);
+    load();
+  }
+
+  async function onCopy() {
+    if (!payload) return;
+    try {
+      await navigator.clipboard.writeText(payload.text);
+      setCopied(true);
+      setTimeout(() => setCopied(false), 1200);
+    } catch {}
+  }
+
+  return (
+    <div className={clsx('theme-code-block', 'static-code', 'language-json', styles.payload)}>
+      <div className={styles.header}>
+        <button
+          type="button"
+          className={clsx('clean-btn', styles.headerButton)}
+          aria-expanded={open}
+          onClick={onToggle}
+          // Start the request as soon as the reader aims for the button
+          onPointerEnter={load}
+          onFocus={load}
+        >
+          <span className={styles.caret}>{open ? '▾' : '▸'}</span>
+          <span className={styles.title}>{title ?? 'Example response'}</span>
+          <span className={styles.meta}>
+            JSON · {entries} {entries === 1 ? 'entry' : 'entries'} · {formatBytes(bytes)}
+          </span>
+        </button>
+        {open && payload && (
+          <button type="button" className={clsx('clean-btn', styles.action)} onClick={onCopy}>
+            {copied ? 'Copied' : 'Copy'}
+          </button>
+        )}
+      </div>
+      {open && (
+        <div className={styles.body}>
+          {payload ? (
+            <JsonTree root={payload.root} highlight={highlight} />
+          ) : error ? (
+            <p className={styles.status}>
+              Couldn't load this example.{' '}
+              <button type="button" className={clsx('clean-btn', styles.retry)} onClick={load}>
+                Retry
+              </button>
+            </p>
+          ) : (
+            <p className={styles.status}>Loading…</p>
+          )}
+        </div>
+      )}
+    </div>
+  );
+}
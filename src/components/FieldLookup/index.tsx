@@ -0,0 +1,167 @@
+import React, {useEffect, useMemo, useState} from 'react';
+import Link from '@docusaurus/Link';
+import {useHistory, useLocation} from '@docusaurus/router';
+import {usePluginData} from '@docusaurus/useGlobalData';
+import styles from './styles.module.css';
+
+type Endpoint = [method: string, path: string, api: string, title: string, docsUrl: string | null];
+type Posting = [endpoint: number, where: string, dottedPath?: string];
+interface FieldIndex {
+  endpoints: Endpoint[];
+  fields: Record<string, [name: string, postings: Posting[]]>;
+}
+
+const WHERE_LABELS: Record<string, string> = {
+  p: 'Path parameter',
+  q: 'Query parameter',
+  h: 'Header',
+  b: 'Request body',
+  r: 'Response',
+  d: 'Docs table',
+};
+
+const BADGE_BY_METHOD: Record<string, string> = {
+  GET: 'badge--primary',
+  POST: 'badge--success',
+  PUT: 'badge--warning',
+  PATCH: 'badge--info',
+  DELETE: 'badge--danger',
+};
+
+const MAX_SUGGESTIONS = 8;
+
+/** Keys starting with `prefix`, by binary search over the sorted keys */
+function suggestionsFor(keys: string[], prefix: string): string[] {
+  let low = 0;
+  let high = keys.length;
+  while (low < high) {
+    const mid = (low + high) >> 1;
+    if (keys[mid] < prefix) low = mid + 1;
+    else high = mid;
+  }
+  const matches: string[] = [];
+  for (let i = low; i < keys.length && keys[i].startsWith(prefix) && matches.length < MAX_SUGGESTIONS; i++) {
+    matches.push(keys[i]);
+  }
+  return matches;
+}
+
+/**
+ * Looks up a property name (e.g. `owId`) in the index built by
+ * plugins/field-index and lists every endpoint that takes or returns it.
+ * `?field=owId` links straight to a lookup.
+ */
+export default function FieldLookup() {
+  const {url} = usePluginData('field-index') as {url: string};
+  const history = useHistory();
+  const location = useLocation();
+  const [index, setIndex] = useState<FieldIndex | null>(null);
+  const [error, setError] = useState(false);
+  const [query, setQuery] = useState(() => new URLSearchParams(location.search).get('field') ?? '');
+
+  useEffect(() => {
+    let cancelled = false;
+    fetch(url)
+      .then((response) => {
+        if (!response.ok) throw new Error(String(response.status));
+        return response.json();
+      })
+      .then((data: FieldIndex) => !cancelled && setIndex(data))
+      .catch(() => !cancelled && setError(true));
+    return () => {
+      cancelled = true;
+    };
+  }, [url]);
+
+  const keys = useMemo(() => (index ? Object.keys(index.fields) : []), [index]);
+  const key = query.trim().toLowerCase();
+  const match = index && key ? index.fields[key] : undefined;
+  const suggestions = index && key && !match ? suggestionsFor(keys, key) : [];
+
+  function lookUp(value: string) {
+    setQuery(value);
+    const params = new URLSearchParams(location.search);
+    if (value) params.set('field', value);
+    else params.delete('field');
+    history.replace({...location, search: params.toString() ? `?${params}` : ''});
+  }
+
+  return (
+    <div className={styles.fieldLookup}>
+      <input
+        type="search"
+        className={styles.input}
+        placeholder="Field name, e.g. owId"
+        aria-label="Field name"
+        autoComplete="off"
+        spellCheck={false}
+        value={query}
+        onChange={(event) => lookUp(event.target.value)}
+      />
+      {error && <p className={styles.message}>The field index could not be loaded.</p>}
+      {!index && !error && <p className={styles.message}>Loading field index…</p>}
+      {index && key && !match && (
+        <p className={styles.message}>
+          No endpoint uses <code>{query.trim()}</code>
+          {suggestions.length > 0 && (
+            <>
+              . Did you mean{' '}
+              {suggestions.map((suggestion, i) => (
+                <React.Fragment key={suggestion}>
+                  {i > 0 && ', '}
+                  <button type="button" className={styles.suggestion} onClick={() => lookUp(index.fields[suggestion][0])}>
+                    {index.fields[suggestion][0]}
+                  </button>
+                </React.Fragment>
+              ))}
+              ?
+            </>
+          )}
+        </p>
+      )}
+      {index && match && (
+        <>
+          <p className={styles.message}>
+            <code>{match[0]}</code> is used by {new Set(match[1].map(([endpoint]) => endpoint)).size} endpoints.
+          </p>
+          <table className={styles.results}>
+            <thead>
+              <tr>
+                <th>Endpoint</th>
+                <th>API</th>
+                <th>Where</th>
+              </tr>
+            </thead>
+            <tbody>
+              {match[1].map(([endpointIndex, where, dottedPath], i) => {
+                const [method, path, api, title, docsUrl] = index.endpoints[endpointIndex];
+                return (
+                  <tr key={i}>
+                    <td>
+                      <span className={`badge ${BADGE_BY_METHOD[method] ?? BADGE_BY_METHOD.GET} ${styles.method}`}>
+                        {method === 'DELETE' ? 'DEL' : method}
+                      </span>
+                      <code>{path}</code>
+                      <br />
+                      {docsUrl ? <Link to={docsUrl}>{title}</Link> : title}
+                    </td>
+                    <td>{api}</td>
+                    <td>
+                      {WHERE_LABELS[where]}
+                      {dottedPath && (
+                        <>
+                          <br />
+                          <code>{dottedPath}</code>
+                        </>
+                      )}
+                    </td>
+                  </tr>
+                );
+              })}
+            </tbody>
+          </table>
+        </>
+      )}
+    </div>
+  );
+}
@@ -7,7 +7,21 @@ export default function ImageLightbox({
   alt = '',
   size = 48,    // thumbnail box size (px)
   radius = 8,   // corner radius (px)
-}: { thumb: string; full: string; alt?: string; size?: number; radius?: number }) {
+  width,        // intrinsic size of `full`, added by plugins/images
+  height,
+  srcSetAvif,   // resized variants, added by plugins/images once generated
+  srcSetWebp,
+}: {
+  thumb: string;
+  full: string;
+  alt?: string;
+  size?: number;
+  radius?: number;
+  width?: number | string;
+  height?: number | string;
+  srcSetAvif?: string;
+  srcSetWebp?: string;
+}) {
   const [open, setOpen] = React.useState(false);
   const t = useBaseUrl(thumb);
   const f = useBaseUrl(full);
@@ -37,12 +51,20 @@ export default function ImageLightbox({
           display: 'inline-block',
         }}
       >
-        <img
-          src={t}
-          alt={alt}
-          loading="lazy"
-          style={{ width: '100%', height: '100%', objectFit: 'cover', display: 'block' }}
-        />
+        {/* The thumbnail picks the smallest variant; the full-size file only loads once opened */}
+        <picture>
+          {srcSetAvif && <source type="image/avif" srcSet={srcSetAvif} sizes={`${size}px`} />}
+          {srcSetWebp && <source type="image/webp" srcSet={srcSetWebp} sizes={`${size}px`} />}
+          <img
+            src={t}
+            alt={alt}
+            loading="lazy"
+            decoding="async"
+            width={size}
+            height={size}
+            style={{ width: '100%', height: '100%', objectFit: 'cover', display: 'block' }}
+          />
+        </picture>
       </button>
 
       {open && (
@@ -63,10 +85,14 @@ export default function ImageLightbox({
           <img
             src={f}
             alt={alt}
+            width={width}
+            height={height}
             onClick={(e) => e.stopPropagation()}
             style={{
               maxWidth: 'min(90vw, 1200px)',
               maxHeight: '90vh',
+              width: 'auto',
+              height: 'auto',
               borderRadius: 12,
               boxShadow: '0 8px 40px rgba(0,0,0,.4)',
             }}
@@ -0,0 +1,7 @@
+import island from '@site/src/components/Island';
+
+// Thumbnails sit inside paragraphs
+export default island(() => import('./ImageLightBox'), require.resolveWeak('./ImageLightBox'), {
+  hydrate: 'interaction',
+  inline: true,
+});
@@ -0,0 +1,7 @@
+import island from '@site/src/components/Island';
+// With the route, so the inert server markup is styled before the island loads
+import './styles.module.css';
+
+export default island(() => import('./IntegrationInquiry'), require.resolveWeak('./IntegrationInquiry'), {
+  hydrate: 'interaction',
+});
@@ -0,0 +1,195 @@
+import React, {useEffect, useRef, useState, type ComponentType} from 'react';
+import useIsBrowser from '@docusaurus/useIsBrowser';
+import ExecutionEnvironment from '@docusaurus/ExecutionEnvironment';
+
+declare const __webpack_require__: (id: string | number) => {default: ComponentType<any>};
+declare const __webpack_modules__: Record<string | number, unknown>;
+
+type ModuleId = string | number;
+
+/**
+ * - `visible`: once the island comes near the viewport
+ * - `interaction`: on the first hover, focus or touch
+ */
+export type Hydrate = 'visible' | 'interaction';
+
+interface IslandOptions {
+  hydrate?: Hydrate;
+  /** Wrap in a `<span>`, for widgets rendered inside a paragraph */
+  inline?: boolean;
+}
+
+// Start loading a little before the island scrolls into view
+const ROOT_MARGIN = '400px 0px';
+const INTERACTIONS = ['pointerenter', 'focusin', 'touchstart'] as const;
+
+/**
+ * Child indexes from `root` down to `target` (or its closest HTML element,
+ * for a click on an SVG icon), to find the same element in the hydrated markup
+ */
+function pathOf(root: Node, target: EventTarget | null): number[] | undefined {
+  let start = target as Node | null;
+  while (start && !(start instanceof HTMLElement)) start = start.parentNode;
+  const path: number[] = [];
+  for (let node = start; node && node !== root; node = node.parentNode) {
+    if (!node.parentNode) return undefined;
+    path.unshift(Array.prototype.indexOf.call(node.parentNode.childNodes, node));
+  }
+  return start ? path : undefined;
+}
+
+function nodeAt(root: Node, path: number[]): HTMLElement | undefined {
+  let node: Node | undefined = root;
+  for (const index of path) node = node?.childNodes[index];
+  return node instanceof HTMLElement ? node : undefined;
+}
+
+/** The module, when its chunk is already evaluated (always on the server, whose bundle is one chunk) */
+function loadedModule(id: ModuleId) {
+  return __webpack_modules__[id] ? __webpack_require__(id).default : undefined;
+}
+
+/**
+ * While the server markup is inert, a click on it would be lost and focus
+ * would drop when the widget replaces it: the click is held back and
+ * replayed, and focus moved, on the same element once the widget is
+ * rendered.
+ */
+function useReplay(ref: React.RefObject<HTMLElement>, waiting: boolean, rendered: boolean, activate: () => void) {
+  const pending = useRef<{focus?: number[]; click?: number[]}>({});
+
+  useEffect(() => {
+    const node = ref.current;
+    if (!waiting || !node) return undefined;
+    const onFocus = (event: FocusEvent) => {
+      pending.current.focus = pathOf(node, event.target);
+    };
+    const onBlur = (event: FocusEvent) => {
+      // Tabbed out of the island; a removed element has no relatedTarget
+      if (event.relatedTarget instanceof Node && !node.contains(event.relatedTarget)) pending.current.focus = undefined;
+    };
+    const onClick = (event: MouseEvent) => {
+      event.preventDefault();
+      event.stopPropagation();
+      pending.current.click = pathOf(node, event.target);
+      activate();
+    };
+    node.addEventListener('focusin', onFocus);
+    node.addEventListener('focusout', onBlur);
+    node.addEventListener('click', onClick, {capture: true});
+    return () => {
+      node.removeEventListener('focusin', onFocus);
+      node.removeEventListener('focusout', onBlur);
+      node.removeEventListener('click', onClick, {capture: true});
+    };
+  }, [ref, waiting, activate]);
+
+  useEffect(() => {
+    const node = ref.current;
+    if (!rendered || !node) return;
+    const {focus, click} = pending.current;
+    pending.current = {};
+    // Only if focus was lost with the markup, not moved elsewhere since
+    if (focus && (document.activeElement === document.body || !document.activeElement)) {
+      nodeAt(node, focus)?.focus();
+    }
+    if (click) nodeAt(node, click)?.click();
+  }, [ref, rendered]);
+}
+
+function useTrigger(ref: React.RefObject<HTMLElement>, hydrate: Hydrate, active: boolean, activate: () => void) {
+  useEffect(() => {
+    const node = ref.current;
+    if (active || !node) return undefined;
+    if (hydrate === 'interaction') {
+      INTERACTIONS.forEach((type) => node.addEventListener(type, activate, {once: true, passive: true}));
+      return () => INTERACTIONS.forEach((type) => node.removeEventListener(type, activate));
+    }
+    if (typeof IntersectionObserver === 'undefined') {
+      activate();
+      return undefined;
+    }
+    const observer = new IntersectionObserver(
+      (entries) => {
+        if (entries.some((entry) => entry.isIntersecting)) activate();
+      },
+      {rootMargin: ROOT_MARGIN},
+    );
+    observer.observe(node);
+    return () => observer.disconnect();
+  }, [ref, hydrate, active, activate]);
+}
+
+/**
+ * Turns a widget into an island: it is rendered into the static HTML, but
+ * its code is a separate chunk and the server markup stays inert (not
+ * hydrated) until the island is visible or interacted with, so the page
+ * around it doesn't pay for it.
+ *
+ *   export default island(() => import('./Widget'), require.resolveWeak('./Widget'), {hydrate: 'interaction'});
+ *
+ * On client-side navigations there is no server markup to show:
+ * `interaction` islands then load as soon as they are visible. Clicks and
+ * focus on the inert markup carry over to the widget (useReplay).
+ */
+export default function island<P extends object>(
+  load: () => Promise<{default: ComponentType<P>}>,
+  moduleId: ModuleId,
+  {hydrate = 'visible', inline = false}: IslandOptions = {},
+): ComponentType<P> {
+  const Wrapper = inline ? 'span' : 'div';
+
+  function Island(props: P) {
+    const isBrowser = useIsBrowser();
+    // True only while hydrating a server-rendered page, never after navigation
+    const [hydrating] = useState(() => ExecutionEnvironment.canUseDOM && !isBrowser);
+    const [Component, setComponent] = useState<ComponentType<P> | undefined>(() =>
+      hydrating ? undefined : loadedModule(moduleId),
+    );
+    const [active, setActive] = useState(false);
+    const ref = useRef<HTMLElement>(null);
+    const activate = useRef(() => setActive(true)).current;
+
+    useTrigger(ref, hydrating ? hydrate : 'visible', active || Boolean(Component), activate);
+    useReplay(ref, hydrating && !Component, Boolean(Component), activate);
+
+    useEffect(() => {
+      if (!active || Component) return undefined;
+      let cancelled = false;
+      load().then((mod) => {
+        if (!cancelled) setComponent(() => mod.default);
+      });
+      return () => {
+        cancelled = true;
+      };
+    }, [active, Component]);
+
+    if (!ExecutionEnvironment.canUseDOM) {
+      const ServerComponent = loadedModule(moduleId);
+      return <Wrapper>{ServerComponent && <ServerComponent {...props} />}</Wrapper>;
+    }
+
+    if (Component) {
+      return (
+        <Wrapper ref={ref as React.RefObject<never>}>
+          <Component {...props} />
+        </Wrapper>
+      );
+    }
+
+    if (hydrating) {
+      // Keeps the server markup in place without hydrating it
+      return (
+        <Wrapper
+          ref={ref as React.RefObject<never>}
+          dangerouslySetInnerHTML={{__html: ''}}
+          suppressHydrationWarning
+        />
+      );
+    }
+
+    return <Wrapper ref={ref as React.RefObject<never>} />;
+  }
+
+  return Island;
+}
@@ -0,0 +1,138 @@
+import React, {useEffect, useRef, useState, type ComponentType} from 'react';
+import {useLocation} from '@docusaurus/router';
+import useIsBrowser from '@docusaurus/useIsBrowser';
+import ExecutionEnvironment from '@docusaurus/ExecutionEnvironment';
+import styles from './styles.module.css';
+
+declare const __webpack_require__: (id: string | number) => ChunkModule;
+declare const __webpack_modules__: Record<string | number, unknown>;
+
+type ChunkModule = {default: ComponentType};
+
+interface LazyEndpointProps {
+  /** Heading id of the section this chunk belongs to */
+  section: string;
+  /** Dynamic import of the section body, injected by plugins/lazy-endpoints */
+  load: () => Promise<ChunkModule>;
+  /** `require.resolveWeak` of the chunk, to render it synchronously on the server */
+  moduleId: string | number;
+}
+
+// Start fetching well before the section scrolls into view
+const ROOT_MARGIN = '1200px 0px';
+
+const targetOf = (hash: string) => (hash ? decodeURIComponent(hash.slice(1)) : '');
+
+/** The chunk, when it is already evaluated (always on the server, whose bundle is one chunk) */
+function loadedModule(id: string | number) {
+  return __webpack_modules__[id] ? __webpack_require__(id).default : undefined;
+}
+
+/**
+ * On a server-rendered page the section is in the static HTML (for search
+ * crawlers and readers without JavaScript) and stays there, not hydrated,
+ * until its chunk has loaded. After a client-side navigation there is no
+ * such markup: a placeholder stands in until then.
+ */
+export default function LazyEndpoint({section, load, moduleId}: LazyEndpointProps) {
+  const {hash} = useLocation();
+  const isBrowser = useIsBrowser();
+  // True only while hydrating a server-rendered page, never after navigation
+  const [hydrating] = useState(() => ExecutionEnvironment.canUseDOM && !isBrowser);
+  const ref = useRef<HTMLDivElement>(null);
+  const loadRef = useRef(load);
+  const pendingHash = useRef('');
+  const [requested, setRequested] = useState(false);
+  // Bumped by "Retry" after a failed load
+  const [attempt, setAttempt] = useState(0);
+  const [failed, setFailed] = useState(false);
+  const [Content, setContent] = useState<ComponentType | null>(null);
+
+  loadRef.current = load;
+
+  // A deep link into content that isn't mounted yet (e.g. a #### heading
+  // inside a chunk) loads every chunk so the anchor can resolve
+  useEffect(() => {
+    const target = targetOf(hash);
+    if (!requested && target && !document.getElementById(target)) {
+      pendingHash.current = target;
+      setRequested(true);
+    }
+  }, [hash, requested]);
+
+  useEffect(() => {
+    if (requested) return undefined;
+    const node = ref.current;
+    if (!node || typeof IntersectionObserver === 'undefined') {
+      setRequested(true);
+      return undefined;
+    }
+    const observer = new IntersectionObserver(
+      (entries) => {
+        if (entries.some((entry) => entry.isIntersecting)) setRequested(true);
+      },
+      {rootMargin: ROOT_MARGIN},
+    );
+    observer.observe(node);
+    return () => observer.disconnect();
+  }, [requested]);
+
+  useEffect(() => {
+    if (!requested) return undefined;
+    let cancelled = false;
+    setFailed(false);
+    loadRef.current().then(
+      (mod) => {
+        if (!cancelled) setContent(() => mod.default);
+      },
+      (error) => {
+        // e.g. a chunk of an older deploy that is gone; the server markup, if any, stays
+        console.error(`Could not load the "${section}" section`, error);
+        if (!cancelled) setFailed(true);
+      },
+    );
+    return () => {
+      cancelled = true;
+    };
+  }, [requested, attempt, section]);
+
+  useEffect(() => {
+    if (!Content || !pendingHash.current) return;
+    document.getElementById(pendingHash.current)?.scrollIntoView();
+    pendingHash.current = '';
+  }, [Content]);
+
+  if (!ExecutionEnvironment.canUseDOM) {
+    const ServerContent = loadedModule(moduleId);
+    return <div data-section={section}>{ServerContent && <ServerContent />}</div>;
+  }
+
+  if (Content) {
+    return (
+      <div ref={ref} data-section={section}>
+        <Content />
+      </div>
+    );
+  }
+
+  if (hydrating) {
+    // Keeps the server markup in place without hydrating it
+    return (
+      <div ref={ref} data-section={section} dangerouslySetInnerHTML={{__html: ''}} suppressHydrationWarning />
+    );
+  }
+
+  return (
+    <div ref={ref} className={styles.placeholder} data-section={section}>
+      {failed ? (
+        <button type="button" className={styles.loadButton} onClick={() => setAttempt((n) => n + 1)}>
+          Couldn't load the endpoint details. Retry
+        </button>
+      ) : (
+        <button type="button" className={styles.loadButton} onClick={() => setRequested(true)}>
+          {requested ? 'Loading…' : 'Show endpoint details'}
+        </button>
+      )}
+    </div>
+  );
+}
@@ -0,0 +1,33 @@
+import React, {useState, type ComponentProps} from 'react';
+import Details from '@theme/Details';
+import LazyMount from './LazyMount';
+
+type LazyDetailsProps = Omit<ComponentProps<'details'>, 'ref'>;
+
+/**
+ * `<details>` whose body mounts on first open. Hover and focus mount it a
+ * little early so the expand animation measures the real content height.
+ */
+export default function LazyDetails({children, ...props}: LazyDetailsProps) {
+  const [active, setActive] = useState(Boolean(props.open));
+  const activate = () => setActive(true);
+
+  const items = React.Children.toArray(children);
+  const summary = items.find(
+    (item): item is React.ReactElement => React.isValidElement(item) && item.type === 'summary',
+  );
+  const content = items.filter((item) => item !== summary);
+
+  return (
+    <Details
+      {...props}
+      summary={summary}
+      onToggle={activate}
+      onMouseEnter={activate}
+      onFocus={activate}
+      onTouchStart={activate}
+    >
+      <LazyMount active={active}>{content}</LazyMount>
+    </Details>
+  );
+}
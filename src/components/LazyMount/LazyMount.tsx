@@ -0,0 +1,43 @@
+import React, {useState, type ReactNode} from 'react';
+import useIsBrowser from '@docusaurus/useIsBrowser';
+import ExecutionEnvironment from '@docusaurus/ExecutionEnvironment';
+
+interface LazyMountProps {
+  /** Mount the children once this becomes true; they then stay mounted */
+  active: boolean;
+  className?: string;
+  children: ReactNode;
+}
+
+/**
+ * Renders children on the server so the static HTML stays complete for
+ * search crawlers, but doesn't hydrate them until first shown. On client-side
+ * navigations (no server HTML) nothing is rendered until then.
+ */
+export default function LazyMount({active, className, children}: LazyMountProps) {
+  const isBrowser = useIsBrowser();
+  // True only while hydrating a server-rendered page, never after navigation
+  const [hydrating] = useState(() => ExecutionEnvironment.canUseDOM && !isBrowser);
+  const [mounted, setMounted] = useState(active);
+
+  if (active && !mounted) {
+    setMounted(true);
+  }
+
+  if (!ExecutionEnvironment.canUseDOM || mounted) {
+    return <div className={className}>{children}</div>;
+  }
+
+  if (hydrating) {
+    // Keeps the server markup in place without hydrating it
+    return (
+      <div
+        className={className}
+        dangerouslySetInnerHTML={{__html: ''}}
+        suppressHydrationWarning
+      />
+    );
+  }
+
+  return <div className={className} />;
+}
@@ -0,0 +1,2 @@
+export { default as LazyMount } from './LazyMount';
+export { default as LazyDetails } from './LazyDetails';
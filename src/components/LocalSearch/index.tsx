@@ -0,0 +1,135 @@
+import React, {useEffect, useId, useRef, useState} from 'react';
+import clsx from 'clsx';
+import Link from '@docusaurus/Link';
+import {useHistory} from '@docusaurus/router';
+import useBaseUrl from '@docusaurus/useBaseUrl';
+import type {SearchResult, WorkerRequest, WorkerResponse} from './search.worker';
+import styles from './styles.module.css';
+
+// Input settles for this long before a query is sent
+const DEBOUNCE_MS = 60;
+
+/**
+ * Offline search over headings, endpoint paths and property names, next to
+ * the Algolia search box. The index (plugins/search) and the worker that
+ * queries it are only loaded once the input gets focus.
+ */
+export default function LocalSearch({className}: {className?: string; mobile?: boolean}) {
+  const id = useId();
+  const history = useHistory();
+  const manifestUrl = useBaseUrl('/search/manifest.json');
+  const worker = useRef<Worker | null>(null);
+  const lastRequest = useRef(0);
+  const [query, setQuery] = useState('');
+  const [results, setResults] = useState<SearchResult[]>([]);
+  const [status, setStatus] = useState<'idle' | 'loading' | 'ready' | 'error'>('idle');
+  const [open, setOpen] = useState(false);
+  const [active, setActive] = useState(0);
+
+  function ensureWorker() {
+    if (worker.current || typeof Worker === 'undefined') return;
+    worker.current = new Worker(new URL('./search.worker.ts', import.meta.url));
+    worker.current.onmessage = (event: MessageEvent<WorkerResponse>) => {
+      // Answers to superseded queries are dropped
+      if (event.data.id !== lastRequest.current) return;
+      setResults(event.data.results);
+      setActive(0);
+      setStatus(event.data.error ? 'error' : 'ready');
+    };
+  }
+
+  useEffect(() => () => worker.current?.terminate(), []);
+
+  useEffect(() => {
+    if (!query.trim()) {
+      lastRequest.current += 1;
+      setResults([]);
+      return undefined;
+    }
+    const timer = setTimeout(() => {
+      ensureWorker();
+      if (!worker.current) return;
+      lastRequest.current += 1;
+      setStatus((current) => (current === 'idle' ? 'loading' : current));
+      const request: WorkerRequest = {id: lastRequest.current, manifestUrl, query};
+      worker.current.postMessage(request);
+    }, DEBOUNCE_MS);
+    return () => clearTimeout(timer);
+  }, [query, manifestUrl]);
+
+  function onKeyDown(event: React.KeyboardEvent<HTMLInputElement>) {
+    if (event.key === 'ArrowDown') {
+      event.preventDefault();
+      setActive((index) => Math.min(index + 1, results.length - 1));
+    } else if (event.key === 'ArrowUp') {
+      event.preventDefault();
+      setActive((index) => Math.max(index - 1, 0));
+    } else if (event.key === 'Enter' && results[active]) {
+      history.push(results[active].url);
+      setOpen(false);
+    } else if (event.key === 'Escape') {
+      setOpen(false);
+    }
+  }
+
+  const showResults = open && query.trim() !== '';
+
+  return (
+    <div className={clsx(styles.localSearch, className)}>
+      <input
+        type="search"
+        className={styles.input}
+        placeholder="Fields, endpoints…"
+        aria-label="Search fields, endpoints and headings"
+        aria-controls={id}
+        aria-expanded={showResults}
+        role="combobox"
+        autoComplete="off"
+        spellCheck={false}
+        value={query}
+        onFocus={() => {
+          ensureWorker();
+          setOpen(true);
+        }}
+        onBlur={() => setOpen(false)}
+        onChange={(event) => {
+          setQuery(event.target.value);
+          setOpen(true);
+        }}
+        onKeyDown={onKeyDown}
+      />
+      {showResults && (
+        <ul id={id} role="listbox" className={styles.results}>
+          {status === 'loading' && results.length === 0 && <li className={styles.message}>Loading index…</li>}
+          {status === 'error' && <li className={styles.message}>Search index unavailable</li>}
+          {status === 'ready' && results.length === 0 && <li className={styles.message}>No results</li>}
+          {results.map((result, index) => (
+            <li key={result.url} role="option" aria-selected={index === active}>
+              <Link
+                to={result.url}
+                className={clsx(styles.result, index === active && styles.resultActive)}
+                // Keeps the input focused until the link is followed
+                onMouseDown={(event) => event.preventDefault()}
+                onClick={() => setOpen(false)}
+              >
+                <span className={styles.resultTitle}>
+                  {result.method && <span className={styles.method}>{result.method}</span>}
+                  {result.title}
+                </span>
+                {result.path && <code className={styles.path}>{result.path}</code>}
+                {result.matchedFields.length > 0 && (
+                  <span className={styles.fields}>
+                    {result.matchedFields.slice(0, 3).map((field) => (
+                      <code key={field}>{field}</code>
+                    ))}
+                  </span>
+                )}
+                {result.page && <span className={styles.page}>{result.page}</span>}
+              </Link>
+            </li>
+          ))}
+        </ul>
+      )}
+    </div>
+  );
+}
@@ -0,0 +1,135 @@
+/**
+ * Web worker behind <LocalSearch>: loads the index written by plugins/search
+ * and answers queries off the main thread.
+ *
+ * Shards are kept in Cache Storage under their hashed URL, so after a deploy
+ * only the shards whose content changed are downloaded again; shards no
+ * longer listed in the manifest are dropped.
+ */
+
+interface Entry {
+  url: string;
+  title: string;
+  page?: string;
+  method?: string;
+  path?: string;
+  fields?: string[];
+}
+
+interface IndexedEntry extends Entry {
+  section: string;
+  search: {title: string; page: string; path: string; fields: string[]};
+}
+
+export interface SearchResult extends Entry {
+  section: string;
+  /** Property names that matched the query */
+  matchedFields: string[];
+}
+
+export type WorkerRequest = {id: number; manifestUrl: string; query: string; section?: string};
+export type WorkerResponse = {id: number; results: SearchResult[]; error?: string};
+
+const CACHE_NAME = 'local-search';
+const MAX_RESULTS = 20;
+
+let index: Promise<IndexedEntry[]> | null = null;
+
+async function fetchShard(url: string, cache: Cache | null): Promise<Entry[]> {
+  let response = cache ? await cache.match(url) : undefined;
+  if (!response) {
+    response = await fetch(url);
+    if (!response.ok) throw new Error(`${url}: ${response.status}`);
+    if (cache) await cache.put(url, response.clone());
+  }
+  return response.json();
+}
+
+async function loadIndex(manifestUrl: string): Promise<IndexedEntry[]> {
+  const response = await fetch(manifestUrl, {cache: 'no-cache'});
+  if (!response.ok) throw new Error(`${manifestUrl}: ${response.status}`);
+  const {shards} = (await response.json()) as {shards: {name: string; url: string}[]};
+  const cache = typeof caches === 'undefined' ? null : await caches.open(CACHE_NAME).catch(() => null);
+
+  if (cache) {
+    const current = new Set(shards.map((shard) => new URL(shard.url, manifestUrl).href));
+    for (const request of await cache.keys()) {
+      if (!current.has(request.url)) await cache.delete(request);
+    }
+  }
+
+  const loaded = await Promise.all(
+    shards.map(async ({name, url}) =>
+      (await fetchShard(new URL(url, manifestUrl).href, cache)).map((entry) => ({
+        ...entry,
+        section: name,
+        search: {
+          title: entry.title.toLowerCase(),
+          page: (entry.page || '').toLowerCase(),
+          path: (entry.path || '').toLowerCase(),
+          fields: (entry.fields || []).map((field) => field.toLowerCase()),
+        },
+      })),
+    ),
+  );
+  return loaded.flat();
+}
+
+/** Score of one query term against an entry; 0 when it doesn't match */
+function termScore(entry: IndexedEntry, term: string, matchedFields: Set<string>): number {
+  let best = 0;
+  entry.search.fields.forEach((field, i) => {
+    const score = field === term ? 10 : field.startsWith(term) ? 6 : field.includes(term) ? 3 : 0;
+    if (score) matchedFields.add(entry.fields![i]);
+    best = Math.max(best, score);
+  });
+  const {title, path, page} = entry.search;
+  if (title.startsWith(term) || title.includes(` ${term}`)) best = Math.max(best, 8);
+  else if (title.includes(term)) best = Math.max(best, 5);
+  if (path.includes(term)) best = Math.max(best, 5);
+  if (page.includes(term)) best = Math.max(best, 1);
+  return best;
+}
+
+function search(entries: IndexedEntry[], query: string, section?: string): SearchResult[] {
+  const terms = query.toLowerCase().split(/\s+/).filter(Boolean);
+  if (!terms.length) return [];
+  const scored: {score: number; result: SearchResult}[] = [];
+  for (const entry of entries) {
+    if (section && entry.section !== section) continue;
+    const matchedFields = new Set<string>();
+    let score = 0;
+    for (const term of terms) {
+      const value = termScore(entry, term, matchedFields);
+      if (!value) {
+        score = 0;
+        break;
+      }
+      score += value;
+    }
+    if (!score) continue;
+    const {search: _search, ...result} = entry;
+    scored.push({score, result: {...result, matchedFields: [...matchedFields]}});
+  }
+  return scored
+    .sort((a, b) => b.score - a.score)
+    .slice(0, MAX_RESULTS)
+    .map(({result}) => result);
+}
+
+self.onmessage = async (event: MessageEvent<WorkerRequest>) => {
+  const {id, manifestUrl, query, section} = event.data;
+  try {
+    if (!index) {
+      index = loadIndex(manifestUrl);
+      index.catch(() => {
+        index = null;
+      });
+    }
+    const response: WorkerResponse = {id, results: search(await index, query, section)};
+    self.postMessage(response);
+  } catch (error) {
+    const response: WorkerResponse = {id, results: [], error: String(error)};
+    self.postMessage(response);
+  }
+};
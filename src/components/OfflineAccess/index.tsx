@@ -0,0 +1,68 @@
+import React, {useEffect, useState} from 'react';
+import useBaseUrl from '@docusaurus/useBaseUrl';
+import {disableOffline, enableOffline, isOfflineEnabled, isOfflineSupported} from '@site/src/utils/offline';
+import styles from './styles.module.css';
+
+type Status = 'unsupported' | 'off' | 'installing' | 'ready' | 'error';
+
+const MESSAGES: Record<Status, string> = {
+  unsupported: 'This browser does not support offline access.',
+  off: 'Offline access is off.',
+  installing: 'Downloading the guidelines for offline reading…',
+  ready: 'Offline access is on: the guidelines and OpenAPI specifications are available without a connection.',
+  error: 'The offline copy could not be downloaded. Try again once you are back online.',
+};
+
+function waitUntilActive(registration: ServiceWorkerRegistration): Promise<void> {
+  const worker = registration.installing ?? registration.waiting ?? registration.active;
+  if (!worker || worker.state === 'activated') return Promise.resolve();
+  return new Promise((resolve, reject) => {
+    worker.addEventListener('statechange', () => {
+      if (worker.state === 'activated') resolve();
+      if (worker.state === 'redundant') reject(new Error('Service worker installation failed'));
+    });
+  });
+}
+
+/** Turns the offline service worker (plugins/offline) on and off */
+export default function OfflineAccess() {
+  const workerUrl = useBaseUrl('/sw.js');
+  const [status, setStatus] = useState<Status>('off');
+
+  useEffect(() => {
+    if (!isOfflineSupported()) setStatus('unsupported');
+    else if (isOfflineEnabled()) setStatus('ready');
+  }, []);
+
+  async function turnOn() {
+    setStatus('installing');
+    try {
+      await waitUntilActive(await enableOffline(workerUrl));
+      setStatus('ready');
+    } catch {
+      await disableOffline().catch(() => undefined);
+      setStatus('error');
+    }
+  }
+
+  async function turnOff() {
+    await disableOffline();
+    setStatus('off');
+  }
+
+  return (
+    <div className={styles.offlineAccess}>
+      <p>{MESSAGES[status]}</p>
+      {(status === 'off' || status === 'error') && (
+        <button type="button" className={styles.button} onClick={turnOn}>
+          Make available offline
+        </button>
+      )}
+      {status === 'ready' && (
+        <button type="button" className={styles.button} onClick={turnOff}>
+          Turn off offline access
+        </button>
+      )}
+    </div>
+  );
+}
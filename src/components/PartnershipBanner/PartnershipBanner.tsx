@@ -1,5 +1,4 @@
-import React, { useState, useEffect } from 'react';
-import { useLocation } from '@docusaurus/router';
+import React, { useState } from 'react';
 import styles from './styles.module.css';
 
 interface FormData {
@@ -11,10 +10,8 @@ interface FormData {
 }
 
 export default function PartnershipBanner() {
-  const location = useLocation();
   const [isOpen, setIsOpen] = useState(false);
   const [isDismissed, setIsDismissed] = useState(false);
-  const [isMounted, setIsMounted] = useState(false);
   const [formData, setFormData] = useState<FormData>({
     name: '',
     email: '',
@@ -25,15 +22,8 @@ export default function PartnershipBanner() {
   const [isSubmitting, setIsSubmitting] = useState(false);
   const [submitted, setSubmitted] = useState(false);
 
-  useEffect(() => {
-    setIsMounted(true);
-  }, []);
-
-  // Check if we're on the partnerships page
-  const isPartnershipsPage = location.pathname.includes('/partnerships');
-
-  // Don't render if not mounted, not on partnerships pages, or if dismissed
-  if (!isMounted || !isPartnershipsPage || isDismissed) {
+  // Rendered by the partnership pages only, as an island
+  if (isDismissed) {
     return null;
   }
 
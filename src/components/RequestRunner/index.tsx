@@ -0,0 +1,492 @@
+import React, {useEffect, useMemo, useRef, useState} from 'react';
+import {createPortal} from 'react-dom';
+import clsx from 'clsx';
+import {authHeaders, loadCredentials, saveCredentials, type ApiCredentials} from '@site/src/utils/apiCredentials';
+import styles from './styles.module.css';
+
+interface RequestRunnerProps {
+  method: string;
+  /** Endpoint URL as documented, with `{param}` placeholders */
+  url: string;
+  /** `pageNo noOfEntries query` for list endpoints, set by plugins/openapi/remark-endpoint */
+  paging?: string;
+  onClose: () => void;
+}
+
+/** Pagination parameters of a list endpoint, from the spec */
+interface ListPaging {
+  /** `pageNo` + page size, or `offset` + page size */
+  mode: 'pageNo' | 'offset';
+  /** `noOfEntries`, `limit` or `pageSize` */
+  sizeParam: string;
+  /** Where the pagination parameters go */
+  location: 'query' | 'body';
+}
+
+interface Pagination {
+  enabled: boolean;
+  pageSize: number;
+  maxPages: number;
+  concurrency: number;
+}
+
+interface CallResult {
+  page: number;
+  status: number;
+  statusText: string;
+  /** Request start to last byte of the body, in ms */
+  latency: number;
+  bytes: number;
+  /** Length of the first list in the response */
+  items?: number;
+  /** `filteredRecords` / `totalRecords` of the response */
+  total?: number;
+  body: string;
+}
+
+const DEFAULT_ORIGIN = 'https://api.iqm.com';
+const BODY_METHODS = new Set(['POST', 'PUT', 'PATCH', 'DELETE']);
+// Sent only once confirmed; so is a POST that doesn't list
+const CHANGING_METHODS = new Set(['PUT', 'PATCH', 'DELETE']);
+const TOTAL_KEYS = ['filteredRecords', 'totalRecords', 'totalCount', 'total'];
+const PREVIEW_LENGTH = 4000;
+const MAX_CONCURRENCY = 10;
+
+function parsePaging(paging: string | undefined): ListPaging | undefined {
+  const [mode, sizeParam, location] = (paging || '').split(' ');
+  if ((mode !== 'pageNo' && mode !== 'offset') || !sizeParam || (location !== 'query' && location !== 'body')) {
+    return undefined;
+  }
+  return {mode, sizeParam, location};
+}
+
+const shellQuote = (value: string) => `'${value.replace(/'/g, `'\\''`)}'`;
+
+const placeholdersOf = (url: string) => [...new Set([...url.matchAll(/\{(\w+)\}/g)].map((match) => match[1]))];
+
+/** Breadth-first search of a parsed response for the first value `match` accepts */
+function findValue<T>(root: unknown, match: (key: string, value: unknown) => T | undefined): T | undefined {
+  const queue: unknown[] = [root];
+  while (queue.length) {
+    const value = queue.shift();
+    if (!value || typeof value !== 'object') continue;
+    for (const [key, child] of Object.entries(value)) {
+      const found = match(key, child);
+      if (found !== undefined) return found;
+      if (child && typeof child === 'object' && !Array.isArray(child)) queue.push(child);
+    }
+  }
+  return undefined;
+}
+
+function describe(json: unknown): {items?: number; total?: number} {
+  if (Array.isArray(json)) return {items: json.length};
+  return {
+    items: findValue(json, (_key, value) => (Array.isArray(value) ? value.length : undefined)),
+    total: findValue(json, (key, value) => (TOTAL_KEYS.includes(key) && typeof value === 'number' ? value : undefined)),
+  };
+}
+
+function percentile(values: number[], fraction: number): number {
+  const sorted = [...values].sort((a, b) => a - b);
+  return sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * fraction))] ?? 0;
+}
+
+const formatBytes = (bytes: number) => (bytes < 1024 ? `${bytes} B` : `${(bytes / 1024).toFixed(1)} KB`);
+const formatMs = (ms: number) => `${Math.round(ms)} ms`;
+
+/**
+ * "Try it" dialog of `<CopyUrl>`: sends the documented request with the
+ * reader's credentials and, for list endpoints, walks the pages with a
+ * few requests in flight, timing each call. Requests that change data are
+ * only sent once the reader confirms them. When the browser can't reach the
+ * API (offline, or a CORS preflight api.iqm.com doesn't allow), the request
+ * can be copied as a cURL command instead.
+ */
+export default function RequestRunner({method, url, paging, onClose}: RequestRunnerProps) {
+  const dialogRef = useRef<HTMLDialogElement>(null);
+  const abortRef = useRef<AbortController | null>(null);
+  const hasBody = BODY_METHODS.has(method);
+  const listPaging = useMemo(() => parsePaging(paging), [paging]);
+  const changesData = CHANGING_METHODS.has(method) || (method === 'POST' && !listPaging);
+  const initial = useMemo(() => {
+    const absolute = new URL(url.replace(/\{(\w+)\}/g, '__$1__'), DEFAULT_ORIGIN);
+    return {
+      base: `${absolute.origin}${absolute.pathname}`.replace(/__(\w+)__/g, '{$1}'),
+      query: absolute.search.replace(/^\?/, ''),
+    };
+  }, [url]);
+
+  const [credentials, setCredentials] = useState<ApiCredentials>(loadCredentials);
+  const [params, setParams] = useState<Record<string, string>>({});
+  const [query, setQuery] = useState(initial.query);
+  const [body, setBody] = useState(hasBody && method !== 'DELETE' ? '{\n  \n}' : '');
+  const [pagination, setPagination] = useState<Pagination>({
+    enabled: false,
+    pageSize: 50,
+    maxPages: 10,
+    concurrency: 3,
+  });
+  const walking = Boolean(listPaging && pagination.enabled);
+  const [confirming, setConfirming] = useState(false);
+  const [copied, setCopied] = useState(false);
+  const [running, setRunning] = useState(false);
+  const [results, setResults] = useState<CallResult[]>([]);
+  const [elapsed, setElapsed] = useState(0);
+  const [error, setError] = useState('');
+
+  useEffect(() => {
+    const dialog = dialogRef.current;
+    dialog?.showModal();
+    return () => abortRef.current?.abort();
+  }, []);
+
+  const updatePagination = (changes: Partial<Pagination>) => setPagination((current) => ({...current, ...changes}));
+  const updateCredentials = (changes: Partial<ApiCredentials>) =>
+    setCredentials((current) => {
+      const next = {...current, ...changes};
+      saveCredentials(next);
+      return next;
+    });
+
+  /** URL and init of the request for `page` (1-based) */
+  function buildRequest(page: number, parsedBody: unknown): [string, RequestInit] {
+    const path = initial.base.replace(/\{(\w+)\}/g, (match, name) =>
+      params[name] ? encodeURIComponent(params[name]) : match,
+    );
+    const search = new URLSearchParams(query);
+    let payload = parsedBody;
+    if (listPaging && walking) {
+      const values: Record<string, number> =
+        listPaging.mode === 'pageNo'
+          ? {pageNo: page, [listPaging.sizeParam]: pagination.pageSize}
+          : {offset: (page - 1) * pagination.pageSize, [listPaging.sizeParam]: pagination.pageSize};
+      if (listPaging.location === 'query') {
+        for (const [name, value] of Object.entries(values)) search.set(name, String(value));
+      } else {
+        payload = {...(payload as object), ...values};
+      }
+    }
+    const searchString = search.toString();
+    return [
+      `${path}${searchString ? `?${searchString}` : ''}`,
+      {
+        method,
+        headers: {
+          ...authHeaders(credentials),
+          ...(payload !== undefined && {'Content-Type': 'application/json'}),
+        },
+        ...(payload !== undefined && {body: JSON.stringify(payload)}),
+        signal: abortRef.current?.signal,
+      },
+    ];
+  }
+
+  async function call(page: number, parsedBody: unknown): Promise<CallResult> {
+    const [requestUrl, init] = buildRequest(page, parsedBody);
+    const start = performance.now();
+    try {
+      const response = await fetch(requestUrl, init);
+      const text = await response.text();
+      const latency = performance.now() - start;
+      let json: unknown;
+      try {
+        json = JSON.parse(text);
+      } catch {}
+      return {
+        page,
+        status: response.status,
+        statusText: response.statusText,
+        latency,
+        bytes: new TextEncoder().encode(text).length,
+        ...describe(json),
+        body: text,
+      };
+    } catch (reason) {
+      if ((reason as Error).name === 'AbortError') throw reason;
+      return {
+        page,
+        status: 0,
+        statusText: 'Network error: offline, or blocked by CORS (try Copy as cURL)',
+        latency: performance.now() - start,
+        bytes: 0,
+        body: '',
+      };
+    }
+  }
+
+  /** The parsed body, or undefined after reporting what the request is missing */
+  function validate(): {parsedBody: unknown} | undefined {
+    let parsedBody: unknown;
+    if (hasBody && body.trim()) {
+      try {
+        parsedBody = JSON.parse(body);
+      } catch {
+        setError('The request body isn’t valid JSON.');
+        return undefined;
+      }
+    } else if (walking && listPaging?.location === 'body') {
+      parsedBody = {};
+    }
+    const missing = placeholdersOf(initial.base).filter((name) => !params[name]);
+    if (missing.length) {
+      setError(`Fill in ${missing.map((name) => `{${name}}`).join(', ')}.`);
+      return undefined;
+    }
+    setError('');
+    return {parsedBody};
+  }
+
+  function send() {
+    if (!validate()) return;
+    if (changesData) setConfirming(true);
+    else void run();
+  }
+
+  /** The first request as a cURL command, the token left to `$IQM_TOKEN` */
+  async function copyAsCurl() {
+    const valid = validate();
+    if (!valid) return;
+    const [requestUrl, init] = buildRequest(1, valid.parsedBody);
+    const headers = Object.entries(init.headers as Record<string, string>).map(([name, value]) =>
+      name === 'Authorization' ? `-H "Authorization: Bearer $IQM_TOKEN"` : `-H ${shellQuote(`${name}: ${value}`)}`,
+    );
+    const command = [
+      `curl -X ${method} ${shellQuote(requestUrl)}`,
+      ...headers,
+      ...(typeof init.body === 'string' ? [`--data ${shellQuote(init.body)}`] : []),
+    ].join(' \\\n  ');
+    try {
+      await navigator.clipboard.writeText(command);
+      setCopied(true);
+      setTimeout(() => setCopied(false), 1200);
+    } catch {}
+  }
+
+  async function run() {
+    setConfirming(false);
+    const valid = validate();
+    if (!valid) return;
+    const {parsedBody} = valid;
+
+    setResults([]);
+    setRunning(true);
+    abortRef.current = new AbortController();
+    const started = performance.now();
+    const record = (result: CallResult) => setResults((current) => [...current, result]);
+
+    try {
+      const first = await call(1, parsedBody);
+      record(first);
+      const {pageSize, maxPages} = pagination;
+      const failed = (result: CallResult) => result.status < 200 || result.status >= 300;
+      const short = (result: CallResult) => result.items === undefined || result.items < pageSize;
+      if (walking && !failed(first) && !short(first)) {
+        // With a total, the page count is known and every page can be requested
+        // right away; without, requests stop at the first short page
+        const pages = first.total === undefined ? maxPages : Math.min(maxPages, Math.ceil(first.total / pageSize));
+        let next = 2;
+        let done = false;
+        const worker = async () => {
+          while (!done && next <= pages) {
+            const result = await call(next++, parsedBody);
+            record(result);
+            if (failed(result) || (first.total === undefined && short(result))) done = true;
+          }
+        };
+        const concurrency = Math.min(Math.max(pagination.concurrency, 1), MAX_CONCURRENCY);
+        await Promise.all(Array.from({length: concurrency}, worker));
+      }
+    } catch (reason) {
+      if ((reason as Error).name !== 'AbortError') setError(String(reason));
+    } finally {
+      setElapsed(performance.now() - started);
+      setRunning(false);
+    }
+  }
+
+  const latencies = results.map((result) => result.latency);
+  const items = results.reduce((sum, result) => sum + (result.items ?? 0), 0);
+  const bytes = results.reduce((sum, result) => sum + result.bytes, 0);
+  const preview = results.length ? [...results].sort((a, b) => a.page - b.page)[0].body : '';
+
+  return createPortal(
+    <dialog ref={dialogRef} className={styles.dialog} onClose={onClose} aria-label={`Try ${method} ${url}`}>
+      <div className={styles.header}>
+        <span className={styles.title}>
+          <strong>{method}</strong> <code>{initial.base}</code>
+        </span>
+        <button type="button" className={clsx('clean-btn', styles.close)} onClick={() => dialogRef.current?.close()} aria-label="Close">
+          ×
+        </button>
+      </div>
+
+      <fieldset className={styles.section}>
+        <legend>Authentication</legend>
+        <label className={styles.field}>
+          <span>Access token</span>
+          <input
+            type="password"
+            autoComplete="off"
+            value={credentials.token}
+            onChange={(event) => updateCredentials({token: event.target.value})}
+            placeholder="Bearer token"
+          />
+        </label>
+        <label className={styles.field}>
+          <span>X-IAA-OW-ID</span>
+          <input
+            value={credentials.workspaceId}
+            onChange={(event) => updateCredentials({workspaceId: event.target.value})}
+            placeholder="Organization Workspace ID"
+          />
+        </label>
+        <p className={styles.hint}>Kept in this tab only and reused by every endpoint.</p>
+      </fieldset>
+
+      <fieldset className={styles.section}>
+        <legend>Request</legend>
+        {placeholdersOf(initial.base).map((name) => (
+          <label key={name} className={styles.field}>
+            <span>{`{${name}}`}</span>
+            <input value={params[name] ?? ''} onChange={(event) => setParams({...params, [name]: event.target.value})} />
+          </label>
+        ))}
+        <label className={styles.field}>
+          <span>Query</span>
+          <input value={query} onChange={(event) => setQuery(event.target.value)} placeholder="name=value&other=value" />
+        </label>
+        {hasBody && (
+          <label className={styles.field}>
+            <span>JSON body</span>
+            <textarea rows={5} value={body} onChange={(event) => setBody(event.target.value)} spellCheck={false} />
+          </label>
+        )}
+      </fieldset>
+
+      {listPaging && (
+        <fieldset className={styles.section}>
+          <legend>
+            <label>
+              <input
+                type="checkbox"
+                checked={pagination.enabled}
+                onChange={(event) => updatePagination({enabled: event.target.checked})}
+              />{' '}
+              Walk pages
+            </label>
+          </legend>
+          <p className={styles.hint}>
+            With <code>{listPaging.mode}</code> and <code>{listPaging.sizeParam}</code>, in the {listPaging.location}.
+          </p>
+          {pagination.enabled && (
+            <div className={styles.grid}>
+              <label className={styles.field}>
+                <span>Page size</span>
+                <input
+                  type="number"
+                  min={1}
+                  value={pagination.pageSize}
+                  onChange={(event) => updatePagination({pageSize: Math.max(1, Number(event.target.value))})}
+                />
+              </label>
+              <label className={styles.field}>
+                <span>Max pages</span>
+                <input
+                  type="number"
+                  min={1}
+                  value={pagination.maxPages}
+                  onChange={(event) => updatePagination({maxPages: Math.max(1, Number(event.target.value))})}
+                />
+              </label>
+              <label className={styles.field}>
+                <span>Concurrency</span>
+                <input
+                  type="number"
+                  min={1}
+                  max={MAX_CONCURRENCY}
+                  value={pagination.concurrency}
+                  onChange={(event) => updatePagination({concurrency: Number(event.target.value)})}
+                />
+              </label>
+            </div>
+          )}
+        </fieldset>
+      )}
+
+      <div className={styles.actions}>
+        {running ? (
+          <button type="button" className="button button--secondary button--sm" onClick={() => abortRef.current?.abort()}>
+            Stop
+          </button>
+        ) : confirming ? (
+          <>
+            <span className={styles.error}>
+              This {method} changes data of Organization Workspace {credentials.workspaceId || '(none set)'}.
+            </span>
+            <button type="button" className="button button--danger button--sm" onClick={run}>
+              Send {method}
+            </button>
+            <button type="button" className="button button--secondary button--sm" onClick={() => setConfirming(false)}>
+              Cancel
+            </button>
+          </>
+        ) : (
+          <>
+            <button type="button" className="button button--primary button--sm" onClick={send}>
+              Send
+            </button>
+            <button type="button" className="button button--secondary button--sm" onClick={copyAsCurl}>
+              {copied ? 'Copied' : 'Copy as cURL'}
+            </button>
+          </>
+        )}
+        {error && <span className={styles.error}>{error}</span>}
+      </div>
+
+      {results.length > 0 && (
+        <div className={styles.results}>
+          <p className={styles.summary}>
+            {results.length} {results.length === 1 ? 'call' : 'calls'} · {items} items · {formatBytes(bytes)}
+            {!running && ` · ${formatMs(elapsed)} total`}
+            {!running && elapsed > 0 && items > 0 && ` · ${Math.round((items / elapsed) * 1000)} items/s`}
+            {` · p50 ${formatMs(percentile(latencies, 0.5))} · p95 ${formatMs(percentile(latencies, 0.95))}`}
+          </p>
+          <table className={styles.table}>
+            <thead>
+              <tr>
+                <th>Page</th>
+                <th>Status</th>
+                <th>Latency</th>
+                <th>Size</th>
+                <th>Items</th>
+              </tr>
+            </thead>
+            <tbody>
+              {results.map((result) => (
+                <tr key={result.page}>
+                  <td>{result.page}</td>
+                  <td className={result.status >= 200 && result.status < 300 ? styles.ok : styles.failed}>
+                    {result.status || '—'} {result.statusText}
+                  </td>
+                  <td>{formatMs(result.latency)}</td>
+                  <td>{formatBytes(result.bytes)}</td>
+                  <td>
+                    {result.items ?? '—'}
+                    {result.total !== undefined && ` / ${result.total}`}
+                  </td>
+                </tr>
+              ))}
+            </tbody>
+          </table>
+          {preview && (
+            <pre className={styles.preview}>
+              {preview.length > PREVIEW_LENGTH ? `${preview.slice(0, PREVIEW_LENGTH)}\n…` : preview}
+            </pre>
+          )}
+        </div>
+      )}
+    </dialog>,
+    document.body,
+  );
+}
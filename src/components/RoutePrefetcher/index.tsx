@@ -0,0 +1,124 @@
+import {useEffect} from 'react';
+import {useLocation} from '@docusaurus/router';
+import {nextRoutes} from '@site/src/utils/navigationHistory';
+
+interface RoutePrefetcherProps {
+  /** Permalinks of the next and previous docs in the sidebar */
+  next?: string;
+  previous?: string;
+}
+
+// Bytes of chunks prefetched per page view, at most
+const BUDGET_BYTES = 250 * 1024;
+const MAX_ROUTES = 8;
+const IDLE_TIMEOUT_MS = 5000;
+
+type Docusaurus = {prefetch: (routePath: string) => false | Promise<void>};
+
+const normalizeRoute = (pathname: string) =>
+  pathname.endsWith('/') || /\.[a-z0-9]+$/i.test(pathname) ? pathname : `${pathname}/`;
+
+function saveData(): boolean {
+  const connection = (navigator as any).connection;
+  return Boolean(connection && (connection.saveData || /(^|-)2g$/.test(connection.effectiveType ?? '')));
+}
+
+/** Internal routes linked from the doc content, with the number of links to each */
+function crossReferences(currentRoute: string): Map<string, number> {
+  const routes = new Map<string, number>();
+  for (const anchor of document.querySelectorAll<HTMLAnchorElement>('.theme-doc-markdown a[href]')) {
+    if (anchor.origin !== window.location.origin) continue;
+    const route = normalizeRoute(anchor.pathname);
+    if (route !== currentRoute) routes.set(route, (routes.get(route) ?? 0) + 1);
+  }
+  return routes;
+}
+
+/**
+ * Counts the bytes of the resources fetched while connected. Observed
+ * rather than read with getEntriesByType: the Resource Timing buffer stops
+ * at 250 entries, which a long docs session reaches, and then reports
+ * nothing new. Without PerformanceObserver the count stays 0 and only
+ * MAX_ROUTES bounds the prefetches.
+ */
+function resourceBytes() {
+  let bytes = 0;
+  const add = (entries: PerformanceEntryList) => {
+    for (const entry of entries as PerformanceResourceTiming[]) {
+      bytes += entry.encodedBodySize || entry.transferSize || 0;
+    }
+  };
+  let observer: PerformanceObserver | undefined;
+  try {
+    observer = new PerformanceObserver((list) => add(list.getEntries()));
+    observer.observe({type: 'resource'});
+  } catch {
+    observer = undefined;
+  }
+  return {
+    total() {
+      // Entries not delivered to the callback yet
+      if (observer) add(observer.takeRecords());
+      return bytes;
+    },
+    disconnect: () => observer?.disconnect(),
+  };
+}
+
+/**
+ * Prefetches, once the browser is idle, the chunks of the routes a reader
+ * most likely opens next from this doc: the ones this browser went to before
+ * from here, the next/previous sidebar docs and the pages the content links
+ * to (cross-API lookups such as `/guidelines/master-api#get-timezones`).
+ * Stops at `BUDGET_BYTES` and does nothing with Save-Data or on 2G.
+ */
+export default function RoutePrefetcher({next, previous}: RoutePrefetcherProps) {
+  const {pathname} = useLocation();
+
+  useEffect(() => {
+    const docusaurus = (window as any).docusaurus as Docusaurus | undefined;
+    if (!docusaurus || saveData()) return undefined;
+    let cancelled = false;
+
+    const run = async () => {
+      const current = normalizeRoute(pathname);
+      const scores = new Map<string, number>();
+      const add = (route: string | undefined, score: number) => {
+        if (!route) return;
+        const normalized = normalizeRoute(route);
+        if (normalized !== current) scores.set(normalized, (scores.get(normalized) ?? 0) + score);
+      };
+      for (const [route, count] of nextRoutes(pathname)) add(route, 3 * count);
+      add(next, 5);
+      add(previous, 2);
+      for (const [route, links] of crossReferences(current)) add(route, Math.min(links, 4));
+
+      const ranked = [...scores].sort(([, a], [, b]) => b - a).slice(0, MAX_ROUTES);
+      const spent = resourceBytes();
+      try {
+        for (const [route] of ranked) {
+          if (cancelled || spent.total() >= BUDGET_BYTES) return;
+          try {
+            // false when the route is unknown or already prefetched
+            const prefetched = docusaurus.prefetch(route);
+            if (prefetched) await prefetched;
+          } catch {
+            // An unreachable route doesn't stop the others
+          }
+        }
+      } finally {
+        spent.disconnect();
+      }
+    };
+
+    const idle = window.requestIdleCallback ?? ((callback: () => void) => window.setTimeout(callback, 2000));
+    const cancelIdle = window.cancelIdleCallback ?? window.clearTimeout;
+    const handle = idle(() => void run(), {timeout: IDLE_TIMEOUT_MS});
+    return () => {
+      cancelled = true;
+      cancelIdle(handle);
+    };
+  }, [pathname, next, previous]);
+
+  return null;
+}
@@ -0,0 +1,34 @@
+import React, {createContext, useContext, useMemo, type ReactNode} from 'react';
+
+/**
+ * Turns on windowed rendering of long sidebar item lists for the sidebar
+ * below it (see src/theme/DocSidebarItems). Lists shorter than `threshold`
+ * render as usual; longer ones render `chunkSize` items at a time as they
+ * scroll into view.
+ */
+export interface SidebarWindowOptions {
+  threshold: number;
+  chunkSize: number;
+  /** Height reserved for each item not rendered yet, in px */
+  itemHeight: number;
+}
+
+const SidebarWindowContext = createContext<SidebarWindowOptions | null>(null);
+
+export function useSidebarWindow(): SidebarWindowOptions | null {
+  return useContext(SidebarWindowContext);
+}
+
+export default function SidebarWindow({
+  threshold = 40,
+  chunkSize = 25,
+  itemHeight = 36,
+  children,
+}: Partial<SidebarWindowOptions> & {children: ReactNode}) {
+  const value = useMemo(() => ({threshold, chunkSize, itemHeight}), [threshold, chunkSize, itemHeight]);
+  return (
+    <SidebarWindowContext.Provider value={value}>
+      {children}
+    </SidebarWindowContext.Provider>
+  );
+}
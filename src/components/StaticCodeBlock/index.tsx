@@ -0,0 +1,68 @@
+import React, {useMemo, useRef, useState} from 'react';
+import clsx from 'clsx';
+import styles from './styles.module.css';
+
+interface StaticCodeBlockProps {
+  /** Prism language of the block, e.g. `json` */
+  language: string;
+  /** From the fence's `title="..."` */
+  title?: string;
+  /** Token types of the block, `|`-separated, by the letters `tokens` uses */
+  types: string;
+  /** Highlighted code, generated by plugins/highlight/remark: `<` + type letter + text + `>` per token */
+  tokens: string;
+}
+
+const TYPE_CODES = 'abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789';
+
+/** The token-line / token spans of the encoded code: string replacements, no tokenizing */
+function expand(types: string, tokens: string) {
+  const classes = types.split('|');
+  return tokens
+    .replace(
+      /<(.)([^>]*)>/g,
+      (_, code: string, text: string) => `<span class="token ${classes[TYPE_CODES.indexOf(code)]}">${text}</span>`,
+    )
+    .split('\n')
+    .map((line) => `<span class="token-line">${line}</span>`)
+    .join('\n');
+}
+
+/**
+ * Code block highlighted at build time: renders the tokens generated by
+ * plugins/highlight/remark as spans, colored by the CSS variables of
+ * plugins/highlight, so no Prism tokenization runs in the browser.
+ */
+export default function StaticCodeBlock({language, title, types, tokens}: StaticCodeBlockProps) {
+  const html = useMemo(() => expand(types, tokens), [types, tokens]);
+  const codeRef = useRef<HTMLElement>(null);
+  const [copied, setCopied] = useState(false);
+
+  async function onCopy() {
+    try {
+      await navigator.clipboard.writeText(codeRef.current?.textContent ?? '');
+      setCopied(true);
+      setTimeout(() => setCopied(false), 1200);
+    } catch {}
+  }
+
+  return (
+    <div className={clsx('theme-code-block', 'static-code', `language-${language}`, styles.codeBlock)}>
+      {title && <div className={styles.title}>{title}</div>}
+      <div className={styles.content}>
+        <pre className={clsx('prism-code', 'thin-scrollbar', styles.pre)} tabIndex={0}>
+          <code ref={codeRef} className={styles.code} dangerouslySetInnerHTML={{__html: html}} />
+        </pre>
+        <button
+          type="button"
+          className={clsx('clean-btn', styles.copyButton)}
+          onClick={onCopy}
+          aria-label="Copy code to clipboard"
+          title={copied ? 'Copied!' : 'Copy'}
+        >
+          {copied ? 'Copied' : 'Copy'}
+        </button>
+      </div>
+    </div>
+  );
+}
@@ -1,4 +1,5 @@
 import React, { useState } from 'react';
+import { sendGAEvent } from '@site/src/utils/analytics';
 import styles from './FeedbackWidget.module.css';
 
 interface FeedbackWidgetProps {
@@ -18,13 +19,6 @@ const GITHUB_REPO = 'iqmcorp/docs';
 const ISSUES_URL = `https://github.com/${GITHUB_REPO}/issues`;
 const DISCUSSIONS_URL = `https://github.com/${GITHUB_REPO}/discussions`;
 
-// Helper to send GA4 events
-const sendGAEvent = (action: string, params: Record<string, string | boolean>) => {
-  if (typeof window !== 'undefined' && (window as any).gtag) {
-    (window as any).gtag('event', action, params);
-  }
-};
-
 export default function FeedbackWidget({
   pagePath,
   pageTitle,
@@ -1,3 +1,12 @@
-export { default as FeedbackWidget } from './FeedbackWidget';
-export { default as SupportPanel } from './SupportPanel';
-export { default as CommunitySection } from './CommunitySection';
+import island from '@site/src/components/Island';
+
+// Islands: rendered into the static HTML, hydrated on first interaction
+export const FeedbackWidget = island(() => import('./FeedbackWidget'), require.resolveWeak('./FeedbackWidget'), {
+  hydrate: 'interaction',
+});
+export const SupportPanel = island(() => import('./SupportPanel'), require.resolveWeak('./SupportPanel'), {
+  hydrate: 'interaction',
+});
+export const CommunitySection = island(() => import('./CommunitySection'), require.resolveWeak('./CommunitySection'), {
+  hydrate: 'interaction',
+});
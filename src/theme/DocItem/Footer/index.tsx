@@ -3,7 +3,8 @@ import Footer from '@theme-original/DocItem/Footer';
 import type FooterType from '@theme/DocItem/Footer';
 import type {WrapperProps} from '@docusaurus/types';
 import {useDoc} from '@docusaurus/plugin-content-docs/client';
-import SupportPanel from '@site/src/components/Support/SupportPanel';
+import {SupportPanel} from '@site/src/components/Support';
+import RoutePrefetcher from '@site/src/components/RoutePrefetcher';
 
 type Props = WrapperProps<typeof FooterType>;
 
@@ -16,6 +17,7 @@ export default function FooterWrapper(props: Props): ReactNode {
   return (
     <>
       {!isHomepage && <SupportPanel pagePath={metadata.permalink} />}
+      <RoutePrefetcher next={metadata.next?.permalink} previous={metadata.previous?.permalink} />
       <Footer {...props} />
     </>
   );
@@ -2,6 +2,7 @@ import React, {type ReactNode} from 'react';
 import Content from '@theme-original/DocSidebar/Desktop/Content';
 import type ContentType from '@theme/DocSidebar/Desktop/Content';
 import type {WrapperProps} from '@docusaurus/types';
+import SidebarWindow from '@site/src/components/SidebarWindow';
 import styles from './styles.module.css';
 
 const DISCUSSIONS_URL = 'https://github.com/iqmcorp/docs/discussions';
@@ -11,7 +12,10 @@ type Props = WrapperProps<typeof ContentType>;
 export default function ContentWrapper(props: Props): ReactNode {
   return (
     <div className={styles.sidebarWrapper}>
-      <Content {...props} />
+      {/* The API guidelines lists run to hundreds of endpoints */}
+      <SidebarWindow>
+        <Content {...props} />
+      </SidebarWindow>
       <div className={styles.helpSection}>
         <a
           href={`${DISCUSSIONS_URL}/new?category=q-a`}
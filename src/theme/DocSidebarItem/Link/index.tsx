@@ -1,4 +1,4 @@
-import React, {type ReactNode} from 'react';
+import React, {memo, type ReactNode} from 'react';
 import clsx from 'clsx';
 import {ThemeClassNames} from '@docusaurus/theme-common';
 import {isActiveSidebarItem} from '@docusaurus/plugin-content-docs/client';
@@ -19,27 +19,35 @@ function methodToBadge(method?: string) {
   return 'secondary';
 }
 
+// Rendered once per endpoint item; badges only depend on the method
+const MethodBadge = memo(function MethodBadge({method}: {method: string}) {
+  const m = method.toUpperCase();
+  return (
+    <span className={`badge bar badge--${methodToBadge(m)}`} aria-label={`${m} method`}>
+      {m}
+    </span>
+  );
+});
+
 function withMethodBadge(labelNode: React.ReactNode, method?: string) {
   if (!method) return labelNode;
   return (
     <span className="sidebar-item-with-badge" style={{display:'inline-flex',alignItems:'center',gap:'0.25rem'}}>
-      <span className={`badge bar badge--${methodToBadge(method)}`} aria-label={`${method.toUpperCase()} method`}>
-        {method.toUpperCase()}
-      </span>
+      <MethodBadge method={method} />
       <span>{labelNode}</span>
     </span>
   );
 }
 
-function LinkLabel({label}: {label: string}) {
+const LinkLabel = memo(function LinkLabel({label}: {label: string}) {
   return (
     <span title={label} className={styles.linkLabel}>
       {label}
     </span>
   );
-}
+});
 
-export default function DocSidebarItemLink({
+function DocSidebarItemLink({
   item,
   onItemClick,
   activePath,
@@ -83,3 +91,17 @@ export default function DocSidebarItemLink({
     </li>
   );
 }
+
+// A navigation changes `activePath` for every link in the sidebar, but only
+// the previously and newly active links need to re-render
+function propsAreEqual(prev: Props, next: Props): boolean {
+  const {activePath: prevPath, ...prevRest} = prev;
+  const {activePath: nextPath, ...nextRest} = next;
+  const keys = Object.keys({...prevRest, ...nextRest}) as (keyof typeof prevRest)[];
+  return (
+    keys.every((key) => prevRest[key] === nextRest[key]) &&
+    isActiveSidebarItem(prev.item, prevPath) === isActiveSidebarItem(next.item, nextPath)
+  );
+}
+
+export default memo(DocSidebarItemLink, propsAreEqual);
@@ -0,0 +1,89 @@
+import React, {memo, useEffect, useRef, useState, type ReactNode} from 'react';
+import {
+  DocSidebarItemsExpandedStateProvider,
+  isActiveSidebarItem,
+  useVisibleSidebarItems,
+} from '@docusaurus/plugin-content-docs/client';
+import useIsBrowser from '@docusaurus/useIsBrowser';
+import DocSidebarItem from '@theme/DocSidebarItem';
+import type {Props} from '@theme/DocSidebarItems';
+import {useSidebarWindow, type SidebarWindowOptions} from '@site/src/components/SidebarWindow';
+import styles from './styles.module.css';
+
+function AllItems({items, ...props}: Props): ReactNode {
+  return items.map((item, index) => (
+    <DocSidebarItem key={index} item={item} index={index} {...props} />
+  ));
+}
+
+/**
+ * Renders the first chunk of a long list (always including the active
+ * item) and the next chunk each time a spacer standing in for the rest
+ * scrolls near the sidebar viewport.
+ */
+function WindowedItems({
+  items,
+  options,
+  ...props
+}: Props & {options: SidebarWindowOptions}): ReactNode {
+  const {chunkSize, itemHeight} = options;
+  const spacer = useRef<HTMLLIElement>(null);
+  const [count, setCount] = useState(chunkSize);
+  const activeIndex = items.findIndex((item) => isActiveSidebarItem(item, props.activePath));
+  const rendered = Math.min(items.length, Math.max(count, activeIndex + 1));
+
+  useEffect(() => {
+    const node = spacer.current;
+    if (!node) return undefined;
+    if (typeof IntersectionObserver === 'undefined') {
+      setCount(items.length);
+      return undefined;
+    }
+    const observer = new IntersectionObserver(
+      (entries) => {
+        if (entries.some((entry) => entry.isIntersecting)) {
+          setCount(rendered + chunkSize);
+        }
+      },
+      {rootMargin: `${chunkSize * itemHeight}px 0px`},
+    );
+    observer.observe(node);
+    return () => observer.disconnect();
+  }, [rendered, chunkSize, itemHeight, items.length]);
+
+  return (
+    <>
+      <AllItems items={items.slice(0, rendered)} {...props} />
+      {rendered < items.length && (
+        <li
+          ref={spacer}
+          aria-hidden
+          className={styles.spacer}
+          style={{height: (items.length - rendered) * itemHeight}}
+        />
+      )}
+    </>
+  );
+}
+
+function DocSidebarItems({items, ...props}: Props): ReactNode {
+  const visibleItems = useVisibleSidebarItems(items, props.activePath);
+  const options = useSidebarWindow();
+  const isBrowser = useIsBrowser();
+  // Lists present in the server HTML hydrate in full; only lists mounted
+  // later (a category expanded on the client) are windowed
+  const [canWindow] = useState(isBrowser);
+  const windowOptions = canWindow && options && visibleItems.length > options.threshold ? options : null;
+
+  return (
+    <DocSidebarItemsExpandedStateProvider>
+      {windowOptions ? (
+        <WindowedItems items={visibleItems} options={windowOptions} {...props} />
+      ) : (
+        <AllItems items={visibleItems} {...props} />
+      )}
+    </DocSidebarItemsExpandedStateProvider>
+  );
+}
+
+export default memo(DocSidebarItems);
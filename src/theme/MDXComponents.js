@@ -8,8 +8,19 @@ import CardHeader from '@site/src/components/Card/CardHeader';
 import CardImage from '@site/src/components/Card/CardImage';
 import Columns from '@site/src/components/Columns';
 import Column from '@site/src/components/Column';
+import CopyUrl from '@site/src/components/CopyUrl';
+import ExamplePayload from '@site/src/components/ExamplePayload';
+import LazyEndpoint from '@site/src/components/LazyEndpoint';
+import StaticCodeBlock from '@site/src/components/StaticCodeBlock';
+import { LazyDetails } from '@site/src/components/LazyMount';
 import { FeedbackWidget, SupportPanel, CommunitySection } from '@site/src/components/Support';
 
+// Property tables are the bulk of the guideline pages and mostly stay closed
+function Details(props) {
+  const isPropertyTable = /\bobjectPropertiesDetails\b/.test(props.className || '');
+  return isPropertyTable ? <LazyDetails {...props} /> : <MDXComponents.details {...props} />;
+}
+
 export default {
   // Reusing the default mapping
   ...MDXComponents,
@@ -20,6 +31,15 @@ export default {
   CardImage,
   Columns,
   Column,
+  details: Details,
+  // Emitted by the OpenAPI endpoint remark plugin on pages that don't import it
+  CopyUrl,
+  // Emitted by the lazy endpoints remark plugin in place of section bodies
+  LazyEndpoint,
+  // Emitted by the highlight remark plugin for code blocks highlighted at build time
+  StaticCodeBlock,
+  // Emitted by the example payloads remark plugin for large example responses
+  ExamplePayload,
   FeedbackWidget,
   SupportPanel,
   CommunitySection,
@@ -0,0 +1,8 @@
+import ComponentTypes from '@theme-original/NavbarItem/ComponentTypes';
+import LocalSearch from '@site/src/components/LocalSearch';
+
+export default {
+  ...ComponentTypes,
+  // Offline field/endpoint search (plugins/search), next to Algolia's
+  'custom-localSearch': LocalSearch,
+};
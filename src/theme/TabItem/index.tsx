@@ -0,0 +1,16 @@
+import React, {type ReactNode} from 'react';
+import TabItem from '@theme-original/TabItem';
+import type TabItemType from '@theme/TabItem';
+import type {WrapperProps} from '@docusaurus/types';
+import {LazyMount} from '@site/src/components/LazyMount';
+
+type Props = WrapperProps<typeof TabItemType>;
+
+// Hidden tabs keep their server HTML but only hydrate once selected
+export default function TabItemWrapper({children, ...props}: Props): ReactNode {
+  return (
+    <TabItem {...props}>
+      <LazyMount active={!props.hidden}>{children}</LazyMount>
+    </TabItem>
+  );
+}
@@ -0,0 +1,8 @@
+type EventParams = Record<string, string | number | boolean>;
+
+/** Sends a GA4 event through the gtag plugin; a no-op where gtag isn't loaded (dev builds) */
+export const sendGAEvent = (action: string, params: EventParams) => {
+  if (typeof window !== 'undefined' && (window as any).gtag) {
+    (window as any).gtag('event', action, params);
+  }
+};
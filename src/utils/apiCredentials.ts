@@ -0,0 +1,38 @@
+/**
+ * Credentials the "Try it" runner of `<CopyUrl>` sends with its requests.
+ * Shared by every endpoint of the site and kept in sessionStorage, so they
+ * are gone once the tab is closed.
+ */
+
+const STORAGE_KEY = 'iqm-try-it-credentials';
+
+export interface ApiCredentials {
+  /** Access token, sent as `Authorization: Bearer <token>` */
+  token: string;
+  /** Organization Workspace ID, sent as `X-IAA-OW-ID` */
+  workspaceId: string;
+}
+
+export function loadCredentials(): ApiCredentials {
+  try {
+    const stored = JSON.parse(sessionStorage.getItem(STORAGE_KEY) || '{}');
+    return {token: stored.token || '', workspaceId: stored.workspaceId || ''};
+  } catch {
+    return {token: '', workspaceId: ''};
+  }
+}
+
+export function saveCredentials(credentials: ApiCredentials): void {
+  try {
+    sessionStorage.setItem(STORAGE_KEY, JSON.stringify(credentials));
+  } catch {
+    // Storage disabled: the credentials only last as long as the dialog
+  }
+}
+
+export function authHeaders({token, workspaceId}: ApiCredentials): Record<string, string> {
+  return {
+    ...(token && {Authorization: `Bearer ${token.replace(/^Bearer\s+/i, '')}`}),
+    ...(workspaceId && {'X-IAA-OW-ID': workspaceId}),
+  };
+}
@@ -0,0 +1,44 @@
+/**
+ * Page-to-page navigation counts of this browser, kept in localStorage:
+ * which routes the reader usually opens next from a given route.
+ */
+
+const STORAGE_KEY = 'iqm-navigation-history';
+const MAX_ROUTES = 100;
+const MAX_TARGETS = 10;
+
+type History = Record<string, Record<string, number>>;
+
+function read(): History {
+  try {
+    return JSON.parse(localStorage.getItem(STORAGE_KEY) ?? '{}');
+  } catch {
+    return {};
+  }
+}
+
+/** Counts a navigation from `from` to `to` */
+export function recordNavigation(from: string, to: string) {
+  const history = read();
+  const {[to]: count = 0, ...others} = history[from] ?? {};
+  // `to` first, so it wins ties over older targets
+  const ranked = [[to, count + 1] as const, ...Object.entries(others)]
+    .sort(([, a], [, b]) => b - a)
+    .slice(0, MAX_TARGETS);
+  // Re-inserted last: the most recently left routes are kept
+  delete history[from];
+  const updated = Object.fromEntries([
+    ...Object.entries(history).slice(-(MAX_ROUTES - 1)),
+    [from, Object.fromEntries(ranked)],
+  ]);
+  try {
+    localStorage.setItem(STORAGE_KEY, JSON.stringify(updated));
+  } catch {
+    // Storage full or disabled
+  }
+}
+
+/** Routes opened from `from`, most frequent first, with their counts */
+export function nextRoutes(from: string): [route: string, count: number][] {
+  return Object.entries(read()[from] ?? {}).sort(([, a], [, b]) => b - a);
+}
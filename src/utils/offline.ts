@@ -0,0 +1,34 @@
+/**
+ * Opt-in offline mode: registers the service worker written by
+ * plugins/offline. The choice is remembered in localStorage.
+ */
+
+const STORAGE_KEY = 'iqm-offline';
+const CACHE_PREFIX = 'iqm-docs-';
+
+export const isOfflineSupported = () =>
+  typeof navigator !== 'undefined' && 'serviceWorker' in navigator && window.isSecureContext;
+
+export function isOfflineEnabled(): boolean {
+  try {
+    return localStorage.getItem(STORAGE_KEY) === '1';
+  } catch {
+    return false;
+  }
+}
+
+export async function enableOffline(workerUrl: string): Promise<ServiceWorkerRegistration> {
+  localStorage.setItem(STORAGE_KEY, '1');
+  return navigator.serviceWorker.register(workerUrl);
+}
+
+/** Unregisters the worker and drops its caches */
+export async function disableOffline(): Promise<void> {
+  localStorage.removeItem(STORAGE_KEY);
+  for (const registration of await navigator.serviceWorker.getRegistrations()) {
+    await registration.unregister();
+  }
+  for (const name of await caches.keys()) {
+    if (name.startsWith(CACHE_PREFIX)) await caches.delete(name);
+  }
+}